@@ -11,5 +11,8 @@ public class XVTarget : TargetRules
 		DefaultBuildSettings = BuildSettingsVersion.V5;
 		IncludeOrderVersion = EngineIncludeOrderVersion.Unreal5_5;
 		ExtraModuleNames.Add("XV");
+
+		// 게임 스테이트 등 변경 시에만 리플리케이션 비교 (Push Model)
+		bWithPushModel = true;
 	}
 }
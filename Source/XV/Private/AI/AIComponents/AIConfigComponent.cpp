@@ -3,6 +3,7 @@
 #include "Perception/AISenseConfig_Hearing.h"
 #include "Perception/AISenseConfig_Sight.h"
 #include "Perception/AIPerceptionComponent.h"
+#include "AI/Data/Perception/XVPerceptionProfile.h"
 
 UAIConfigComponent::UAIConfigComponent()
 	: AttackRange(100)
@@ -15,6 +16,18 @@ UAIConfigComponent::UAIConfigComponent()
 	, AIbDetectEnemies(true)
 	, AIbDetectNeutrals(true)
 	, AIbDetectFriendlies(true)
+	, bUseCrowdAvoidance(false)
+	, CrowdNeighborRadius(300.f)
+	, CrowdAvoidanceWeight(0.6f)
+	, CrowdTimeHorizon(0.5f)
+	, CrowdMaxNeighbors(6)
+	, bUseImpostor(false)
+	, ImpostorMesh(nullptr)
+	, ImpostorDistance(6000.f)
+	, ImpostorIdleFrames(0, 30)
+	, ImpostorMoveFrames(30, 30)
+	, ImpostorMoveReferenceSpeed(400.f)
+	, ResolvedHearingRange(1000.f)
 {
 }
 
@@ -28,16 +41,36 @@ void UAIConfigComponent::ConfigSetting()
 	AXVControllerBase* AIController = Cast<AXVControllerBase>(Owner->GetController());
 	checkf(AIController != nullptr, TEXT("AIController is NULL"));
 
-	// [3] AI 컨트롤러에서 SightConfig 로 접근해서 값 적용 전 체크
+	// [3] 프로필 적용
+	// 개별 프로필이 컨트롤러(적 타입) 프로필과 다를 때만 리스너 갱신
+	if (PerceptionProfile)
+	{
+		if (AIController->GetAppliedPerceptionProfile() != PerceptionProfile)
+		{
+			AIController->ApplyPerceptionProfile(PerceptionProfile, true);
+		}
+		ResolvedHearingRange = PerceptionProfile->HearingRange;
+		return;
+	}
+
+	// 컨트롤러 생성 시 적 타입 프로필이 이미 적용됨
+	if (const UXVPerceptionProfile* ControllerProfile = AIController->GetAppliedPerceptionProfile())
+	{
+		ResolvedHearingRange = ControllerProfile->HearingRange;
+		return;
+	}
+
+	// [4] 프로필이 없으면 개별 수치 적용 (이전 방식)
 	checkf(AIController->AISightConfig != nullptr, TEXT("AIController->AISightConfig is NULL"));
+	checkf(AIController->AIHearingConfig != nullptr, TEXT("AIController->AIHearingConfig is NULL"));
 	
-    // SightConfig에 DataAsset 값 적용
+    // SightConfig에 값 적용
 	AIController->AISightConfig->SightRadius = AISightRadius;
 	AIController->AISightConfig->LoseSightRadius = AILoseSightRadius;
 	AIController->AISightConfig->PeripheralVisionAngleDegrees = AIPeripheralVisionAngleDegrees;
 	AIController->AISightConfig->SetMaxAge(AISightSetMaxAge);
 
-	// HearingConfig에 DataAsset 값 적용
+	// HearingConfig에 값 적용
 	AIController->AIHearingConfig->HearingRange = AIHearingRange;
 	AIController->AIHearingConfig->SetMaxAge(AIHearingSetMaxAge);
 
@@ -47,14 +80,12 @@ void UAIConfigComponent::ConfigSetting()
 	AIController->AISightConfig->DetectionByAffiliation.bDetectFriendlies = AIbDetectFriendlies;
 
 	// 감지 설정 적용 (귀)
-	AIController->AISightConfig->DetectionByAffiliation.bDetectEnemies = AIbDetectEnemies;
-	AIController->AISightConfig->DetectionByAffiliation.bDetectNeutrals = AIbDetectNeutrals;
-	AIController->AISightConfig->DetectionByAffiliation.bDetectFriendlies = AIbDetectFriendlies;
+	AIController->AIHearingConfig->DetectionByAffiliation.bDetectEnemies = AIbDetectEnemies;
+	AIController->AIHearingConfig->DetectionByAffiliation.bDetectNeutrals = AIbDetectNeutrals;
+	AIController->AIHearingConfig->DetectionByAffiliation.bDetectFriendlies = AIbDetectFriendlies;
+
+	ResolvedHearingRange = AIHearingRange;
 
     // 설정한 AI 퍼셉션 업데이트  
 	AIController->AIPerception->RequestStimuliListenerUpdate();
-	
 }
-
-
-
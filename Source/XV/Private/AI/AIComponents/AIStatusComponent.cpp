@@ -9,9 +9,13 @@ UAIStatusComponent::UAIStatusComponent()
 
 void UAIStatusComponent::TakeDamage(float Damage)
 {
+	if (bIsDead) return;
+
 	Health -= Damage;
 	if (Health <= 0)
 	{
+		bIsDead = true;
+		OnDeath.Broadcast();
 		GetOwner()->Destroy();
 	}
 }
\ No newline at end of file
@@ -0,0 +1,26 @@
+﻿#include "AI/AIComponents/XVEnemyMovementComponent.h"
+
+void UXVEnemyMovementComponent::RequestDirectMove(const FVector& MoveVelocity, bool bForceMaxSpeed)
+{
+	if (CrowdAvoidanceVelocity.IsNearlyZero())
+	{
+		Super::RequestDirectMove(MoveVelocity, bForceMaxSpeed);
+		return;
+	}
+
+	// 목표 방향 속도에 회피 속도를 더하되 원래 속도 크기는 넘지 않게
+	const float RequestedSpeed = MoveVelocity.Size();
+	const FVector AdjustedVelocity = (MoveVelocity + CrowdAvoidanceVelocity).GetClampedToMaxSize(RequestedSpeed);
+
+	Super::RequestDirectMove(AdjustedVelocity, bForceMaxSpeed);
+}
+
+void UXVEnemyMovementComponent::SetCrowdAvoidanceVelocity(const FVector& InVelocity)
+{
+	CrowdAvoidanceVelocity = FVector(InVelocity.X, InVelocity.Y, 0.f);
+}
+
+void UXVEnemyMovementComponent::ClearCrowdAvoidanceVelocity()
+{
+	CrowdAvoidanceVelocity = FVector::ZeroVector;
+}
@@ -3,11 +3,20 @@
 #include "AI/AIComponents/AIStatusComponent.h"
 #include "AI/System/AIController/Base/XVControllerBase.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "Components/SkeletalMeshComponent.h"
 #include "AI/AIComponents/AIConfigComponent.h"
 #include "System/XVGameMode.h"
+#include "System/XVGameState.h"
+#include "AI/System/Spatial/XVEnemySpatialGridSubsystem.h"
+#include "AI/System/Crowd/XVCrowdAvoidanceSubsystem.h"
+#include "AI/System/Perception/XVNoiseAggregatorSubsystem.h"
+#include "AI/System/Animation/XVEnemyAnimBudgetSubsystem.h"
+#include "AI/System/Animation/XVEnemyImpostorSubsystem.h"
+#include "AI/AIComponents/XVEnemyMovementComponent.h"
 
-AXVEnemyBase::AXVEnemyBase()
-	: RotateSpeed(480.f)
+AXVEnemyBase::AXVEnemyBase(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<UXVEnemyMovementComponent>(ACharacter::CharacterMovementComponentName))
+	, RotateSpeed(480.f)
 	, Acceleration(2048.f)
 	, Deceleration(2048.f)
 	, BrakingFriction(2.0f)
@@ -28,14 +37,62 @@ AXVEnemyBase::AXVEnemyBase()
 	checkf(AIStatusComponent != nullptr, TEXT("AIStatusComponent is NULL"));
 	
 	AutoPossessAI = EAutoPossessAI::PlacedInWorldOrSpawned;
+
+	// 화면 크기 기반 애니메이션 프레임 스킵 (URO), 전투 중 끄기/중요도 기반 조절은 UXVEnemyAnimBudgetSubsystem
+	GetMesh()->bEnableUpdateRateOptimizations = true;
 }
 
 void AXVEnemyBase::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// 생존 적 목록에 등록
+	if (AXVGameState* GameState = GetWorld()->GetGameState<AXVGameState>())
+	{
+		GameState->RegisterEnemy(this);
+	}
+
+	// 근접 질의용 공간 격자에 등록
+	if (UXVEnemySpatialGridSubsystem* SpatialGrid = GetWorld()->GetSubsystem<UXVEnemySpatialGridSubsystem>())
+	{
+		SpatialGrid->RegisterEnemy(this);
+	}
+
+	// 사망 이벤트 바인딩
+	AIStatusComponent->OnDeath.AddUObject(this, &AXVEnemyBase::HandleDeath);
+
 	// 세팅 설정
 	AIConfigComponent->ConfigSetting();
+
+	// 소음 후보 질의 반경 갱신
+	if (UXVNoiseAggregatorSubsystem* NoiseAggregator = GetWorld()->GetSubsystem<UXVNoiseAggregatorSubsystem>())
+	{
+		NoiseAggregator->RegisterHearingRange(AIConfigComponent->GetHearingRange());
+	}
+
+	// 군중 회피 (적 타입별 선택)
+	if (AIConfigComponent->bUseCrowdAvoidance)
+	{
+		if (UXVCrowdAvoidanceSubsystem* CrowdAvoidance = GetWorld()->GetSubsystem<UXVCrowdAvoidanceSubsystem>())
+		{
+			CrowdAvoidance->RegisterAgent(this);
+		}
+	}
+
+	// 애니메이션 갱신 예산 (군중용)
+	if (UXVEnemyAnimBudgetSubsystem* AnimBudget = GetWorld()->GetSubsystem<UXVEnemyAnimBudgetSubsystem>())
+	{
+		AnimBudget->RegisterEnemy(this);
+	}
+
+	// 원거리 임포스터 (적 타입별 선택)
+	if (AIConfigComponent->bUseImpostor)
+	{
+		if (UXVEnemyImpostorSubsystem* Impostor = GetWorld()->GetSubsystem<UXVEnemyImpostorSubsystem>())
+		{
+			Impostor->RegisterEnemy(this);
+		}
+	}
 	
 	// MovementComponent 가져오기
 	TObjectPtr<UCharacterMovementComponent> MovementComponent = CastChecked<UCharacterMovementComponent>(GetMovementComponent());
@@ -60,15 +117,32 @@ void AXVEnemyBase::BeginPlay()
 
 void AXVEnemyBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	// OnEnemyKilled 호출
-	if(AXVGameMode* GameMode = GetWorld()->GetAuthGameMode<AXVGameMode>())
+	// 사망 외 이유(레벨 언로드 등)로 제거되면 처치 수에 포함하지 않고 목록에서만 제거
+	if (AXVGameState* GameState = GetWorld()->GetGameState<AXVGameState>())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("OnEnemyKilled"));
-		GameMode->OnEnemyKilled();
+		GameState->UnregisterEnemy(this);
+	}
+
+	if (UXVEnemySpatialGridSubsystem* SpatialGrid = GetWorld()->GetSubsystem<UXVEnemySpatialGridSubsystem>())
+	{
+		SpatialGrid->UnregisterEnemy(this);
+	}
+
+	if (UXVCrowdAvoidanceSubsystem* CrowdAvoidance = GetWorld()->GetSubsystem<UXVCrowdAvoidanceSubsystem>())
+	{
+		CrowdAvoidance->UnregisterAgent(this);
+	}
+
+	if (UXVEnemyAnimBudgetSubsystem* AnimBudget = GetWorld()->GetSubsystem<UXVEnemyAnimBudgetSubsystem>())
+	{
+		AnimBudget->UnregisterEnemy(this);
+	}
+
+	if (UXVEnemyImpostorSubsystem* Impostor = GetWorld()->GetSubsystem<UXVEnemyImpostorSubsystem>())
+	{
+		Impostor->UnregisterEnemy(this);
 	}
 
-	
-		
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -83,6 +157,21 @@ void AXVEnemyBase::Destroyed()
 	Super::Destroyed();
 }
 
+void AXVEnemyBase::HandleDeath()
+{
+	// 사망 연출은 스켈레탈 메쉬로 보여야 하므로 임포스터 대상에서 제외
+	if (UXVEnemyImpostorSubsystem* Impostor = GetWorld()->GetSubsystem<UXVEnemyImpostorSubsystem>())
+	{
+		Impostor->UnregisterEnemy(this);
+	}
+
+	// OnEnemyKilled 호출
+	if (AXVGameMode* GameMode = GetWorld()->GetAuthGameMode<AXVGameMode>())
+	{
+		GameMode->OnEnemyKilled(this);
+	}
+}
+
 void AXVEnemyBase::SetWeapon()
 {
 	if (AIWeaponBaseClass)
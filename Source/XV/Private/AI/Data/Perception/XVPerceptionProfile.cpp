@@ -0,0 +1,89 @@
+﻿#include "AI/Data/Perception/XVPerceptionProfile.h"
+#include "Perception/AISenseConfig_Sight.h"
+#include "Perception/AISenseConfig_Hearing.h"
+
+#if WITH_EDITOR
+#include "Misc/DataValidation.h"
+#endif
+
+#define LOCTEXT_NAMESPACE "XVPerceptionProfile"
+
+void UXVPerceptionProfile::ApplyTo(UAISenseConfig_Sight& SightConfig, UAISenseConfig_Hearing& HearingConfig) const
+{
+	// 눈
+	SightConfig.SightRadius = SightRadius;
+	SightConfig.LoseSightRadius = LoseSightRadius;
+	SightConfig.PeripheralVisionAngleDegrees = PeripheralVisionAngleDegrees;
+	SightConfig.SetMaxAge(SightMaxAge);
+	SightConfig.DetectionByAffiliation.bDetectEnemies = bDetectEnemies;
+	SightConfig.DetectionByAffiliation.bDetectNeutrals = bDetectNeutrals;
+	SightConfig.DetectionByAffiliation.bDetectFriendlies = bDetectFriendlies;
+
+	// 귀
+	HearingConfig.HearingRange = HearingRange;
+	HearingConfig.SetMaxAge(HearingMaxAge);
+	HearingConfig.DetectionByAffiliation.bDetectEnemies = bDetectEnemies;
+	HearingConfig.DetectionByAffiliation.bDetectNeutrals = bDetectNeutrals;
+	HearingConfig.DetectionByAffiliation.bDetectFriendlies = bDetectFriendlies;
+}
+
+bool UXVPerceptionProfile::Validate(TArray<FText>& OutErrors, TArray<FText>& OutWarnings) const
+{
+	if (SightRadius <= 0.f)
+	{
+		OutErrors.Add(LOCTEXT("InvalidSightRadius", "SightRadius must be greater than 0."));
+	}
+
+	if (LoseSightRadius < SightRadius)
+	{
+		OutErrors.Add(LOCTEXT("InvalidLoseSightRadius", "LoseSightRadius must be greater than or equal to SightRadius."));
+	}
+
+	if (PeripheralVisionAngleDegrees <= 0.f || PeripheralVisionAngleDegrees > 180.f)
+	{
+		OutErrors.Add(LOCTEXT("InvalidVisionAngle", "PeripheralVisionAngleDegrees must be in (0, 180]."));
+	}
+
+	if (HearingRange <= 0.f)
+	{
+		OutErrors.Add(LOCTEXT("InvalidHearingRange", "HearingRange must be greater than 0."));
+	}
+
+	if (!bDetectEnemies && !bDetectNeutrals && !bDetectFriendlies)
+	{
+		OutWarnings.Add(LOCTEXT("NoAffiliation", "Profile detects no affiliation; the AI will never perceive anything."));
+	}
+
+	return OutErrors.IsEmpty();
+}
+
+#if WITH_EDITOR
+EDataValidationResult UXVPerceptionProfile::IsDataValid(FDataValidationContext& Context) const
+{
+	EDataValidationResult Result = Super::IsDataValid(Context);
+
+	TArray<FText> Errors;
+	TArray<FText> Warnings;
+	if (!Validate(Errors, Warnings))
+	{
+		Result = EDataValidationResult::Invalid;
+	}
+
+	for (const FText& Error : Errors)
+	{
+		Context.AddError(Error);
+	}
+	for (const FText& Warning : Warnings)
+	{
+		Context.AddWarning(Warning);
+	}
+
+	if (Result == EDataValidationResult::NotValidated)
+	{
+		Result = EDataValidationResult::Valid;
+	}
+	return Result;
+}
+#endif
+
+#undef LOCTEXT_NAMESPACE
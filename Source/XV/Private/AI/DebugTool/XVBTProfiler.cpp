@@ -0,0 +1,241 @@
+﻿#include "AI/DebugTool/XVBTProfiler.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "AIController.h"
+#include "BehaviorTree/BehaviorTree.h"
+#include "BehaviorTree/BehaviorTreeComponent.h"
+#include "BehaviorTree/BlackboardComponent.h"
+#include "BehaviorTree/BlackboardData.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+static TAutoConsoleVariable<bool> CVarXVBTProfilerEnable(
+	TEXT("XV.AI.BTProfiler.Enable"),
+	false,
+	TEXT("XV 비헤이비어 트리 노드 프로파일러 켜기 (적 타입별 실행 횟수/시간/바뀐 블랙보드 키)"));
+
+// === 프로파일러 ==================================================================================================//
+#pragma region Profiler
+
+FXVBTProfiler& FXVBTProfiler::Get()
+{
+	static FXVBTProfiler Instance;
+	return Instance;
+}
+
+bool FXVBTProfiler::IsEnabled()
+{
+	return CVarXVBTProfilerEnable.GetValueOnGameThread();
+}
+
+void FXVBTProfiler::Record(const UBTNode* Node, const UBehaviorTreeComponent& OwnerComp, double Ms, TConstArrayView<FName> ChangedKeys)
+{
+	// 적 타입 = 폰 클래스 (폰이 없으면 컨트롤러 클래스)
+	const AAIController* AIController = OwnerComp.GetAIOwner();
+	const APawn* Pawn = AIController ? AIController->GetPawn() : nullptr;
+	const UClass* EnemyClass = Pawn ? Pawn->GetClass() : (AIController ? AIController->GetClass() : nullptr);
+
+	FXVBTNodeStats* NodeStats = Stats.Find(MakeTuple(FObjectKey(EnemyClass), FObjectKey(Node)));
+	if (!NodeStats)
+	{
+		// 이름은 처음 한 번만 만들어 둠
+		NodeStats = &Stats.Add(MakeTuple(FObjectKey(EnemyClass), FObjectKey(Node)));
+		NodeStats->EnemyType = GetNameSafe(EnemyClass);
+		NodeStats->TreeName = GetNameSafe(Node->GetTreeAsset());
+		NodeStats->NodeName = Node->GetNodeName();
+		NodeStats->NodeClass = Node->GetClass()->GetName();
+	}
+
+	NodeStats->Count++;
+	NodeStats->TotalMs += Ms;
+	NodeStats->MaxMs = FMath::Max(NodeStats->MaxMs, Ms);
+	for (const FName& Key : ChangedKeys)
+	{
+		NodeStats->WrittenKeys.AddUnique(Key);
+	}
+}
+
+void FXVBTProfiler::Reset()
+{
+	Stats.Reset();
+	StartTime = FPlatformTime::Seconds();
+}
+
+TArray<const FXVBTNodeStats*> FXVBTProfiler::GetSortedStats() const
+{
+	TArray<const FXVBTNodeStats*> Sorted;
+	Sorted.Reserve(Stats.Num());
+	for (const TPair<TPair<FObjectKey, FObjectKey>, FXVBTNodeStats>& Pair : Stats)
+	{
+		Sorted.Add(&Pair.Value);
+	}
+	Sorted.Sort([](const FXVBTNodeStats& A, const FXVBTNodeStats& B) { return A.TotalMs > B.TotalMs; });
+	return Sorted;
+}
+
+// Log_XV_AI 는 Test 빌드에서 NoLogging 이므로 덤프 결과는 LogTemp 로 출력
+void FXVBTProfiler::Dump(int32 MaxRows) const
+{
+	const double Elapsed = FMath::Max(FPlatformTime::Seconds() - StartTime, UE_KINDA_SMALL_NUMBER);
+	const TArray<const FXVBTNodeStats*> Sorted = GetSortedStats();
+
+	UE_LOG(LogTemp, Display, TEXT("[BTProfiler] %d nodes over %.1fs (XV.AI.BTProfiler.Enable=%d)"), Sorted.Num(), Elapsed, IsEnabled() ? 1 : 0);
+	UE_LOG(LogTemp, Display, TEXT("[BTProfiler] %-24s %-32s %10s %8s %10s %9s %9s  %s"),
+		TEXT("EnemyType"), TEXT("Node"), TEXT("Count"), TEXT("Calls/s"), TEXT("TotalMs"), TEXT("AvgUs"), TEXT("MaxUs"), TEXT("WrittenKeys"));
+
+	for (int32 i = 0; i < Sorted.Num() && i < MaxRows; i++)
+	{
+		const FXVBTNodeStats& NodeStats = *Sorted[i];
+		FString Keys;
+		for (const FName& Key : NodeStats.WrittenKeys)
+		{
+			Keys += Keys.IsEmpty() ? Key.ToString() : TEXT(", ") + Key.ToString();
+		}
+
+		UE_LOG(LogTemp, Display, TEXT("[BTProfiler] %-24s %-32s %10lld %8.1f %10.3f %9.2f %9.2f  %s"),
+			*NodeStats.EnemyType, *NodeStats.NodeName, NodeStats.Count, NodeStats.Count / Elapsed, NodeStats.TotalMs,
+			NodeStats.TotalMs * 1000.0 / FMath::Max<int64>(NodeStats.Count, 1), NodeStats.MaxMs * 1000.0, *Keys);
+	}
+}
+
+bool FXVBTProfiler::ExportCSV(const FString& Path) const
+{
+	const double Elapsed = FMath::Max(FPlatformTime::Seconds() - StartTime, UE_KINDA_SMALL_NUMBER);
+
+	FString CSV = TEXT("EnemyType,Tree,Node,NodeClass,Count,CallsPerSec,TotalMs,AvgUs,MaxUs,WrittenKeys\n");
+	for (const FXVBTNodeStats* NodeStats : GetSortedStats())
+	{
+		FString Keys;
+		for (const FName& Key : NodeStats->WrittenKeys)
+		{
+			Keys += Keys.IsEmpty() ? Key.ToString() : TEXT(";") + Key.ToString();
+		}
+
+		CSV += FString::Printf(TEXT("%s,%s,\"%s\",%s,%lld,%.2f,%.3f,%.2f,%.2f,%s\n"),
+			*NodeStats->EnemyType, *NodeStats->TreeName, *NodeStats->NodeName.Replace(TEXT("\""), TEXT("'")), *NodeStats->NodeClass,
+			NodeStats->Count, NodeStats->Count / Elapsed, NodeStats->TotalMs,
+			NodeStats->TotalMs * 1000.0 / FMath::Max<int64>(NodeStats->Count, 1), NodeStats->MaxMs * 1000.0, *Keys);
+	}
+
+	if (!FFileHelper::SaveStringToFile(CSV, *Path))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[BTProfiler] Failed to write CSV %s"), *Path);
+		return false;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("[BTProfiler] %d nodes saved to %s"), Stats.Num(), *Path);
+	return true;
+}
+
+#pragma endregion
+
+// === 측정 스코프 =================================================================================================//
+#pragma region Scope
+
+FXVBTProfileScope::FXVBTProfileScope(const UBTNode* InNode, const UBehaviorTreeComponent& InOwnerComp)
+{
+	if (!InNode || !FXVBTProfiler::IsEnabled()) return;
+
+	Node = InNode;
+	OwnerComp = &InOwnerComp;
+	Blackboard = InOwnerComp.GetBlackboardComponent();
+
+	// 블랙보드 값 스냅샷 (키가 몇 개 안 되므로 통째로 복사)
+	const UBlackboardData* BlackboardAsset = Blackboard ? Blackboard->GetBlackboardAsset() : nullptr;
+	if (BlackboardAsset)
+	{
+		for (int32 Index = 0; Index < Blackboard->GetNumKeys(); Index++)
+		{
+			const FBlackboard::FKey KeyID = static_cast<FBlackboard::FKey>(Index);
+			const FBlackboardEntry* Entry = BlackboardAsset->GetKey(KeyID);
+			const uint8* RawData = Blackboard->GetKeyRawData(KeyID);
+			if (Entry && Entry->KeyType && RawData)
+			{
+				BlackboardSnapshot.Append(RawData, Entry->KeyType->GetValueSize());
+			}
+		}
+	}
+
+	StartCycles = FPlatformTime::Cycles64();
+}
+
+FXVBTProfileScope::~FXVBTProfileScope()
+{
+	if (!Node) return;
+
+	const double Ms = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+
+	// 스냅샷과 비교해서 바뀐 키 수집 (노드 실행 중 블랙보드가 교체된 경우는 건너뜀)
+	TArray<FName, TInlineAllocator<8>> ChangedKeys;
+	const UBlackboardData* BlackboardAsset = Blackboard ? Blackboard->GetBlackboardAsset() : nullptr;
+	if (BlackboardAsset && Blackboard == OwnerComp->GetBlackboardComponent())
+	{
+		int32 Offset = 0;
+		for (int32 Index = 0; Index < Blackboard->GetNumKeys(); Index++)
+		{
+			const FBlackboard::FKey KeyID = static_cast<FBlackboard::FKey>(Index);
+			const FBlackboardEntry* Entry = BlackboardAsset->GetKey(KeyID);
+			const uint8* RawData = Blackboard->GetKeyRawData(KeyID);
+			if (!Entry || !Entry->KeyType || !RawData) continue;
+
+			const int32 ValueSize = Entry->KeyType->GetValueSize();
+			if (Offset + ValueSize > BlackboardSnapshot.Num()) break;
+
+			if (FMemory::Memcmp(BlackboardSnapshot.GetData() + Offset, RawData, ValueSize) != 0)
+			{
+				ChangedKeys.Add(Entry->EntryName);
+			}
+			Offset += ValueSize;
+		}
+	}
+
+	FXVBTProfiler::Get().Record(Node, *OwnerComp, Ms, ChangedKeys);
+}
+
+#pragma endregion
+
+// === 콘솔 명령 ==================================================================================================//
+#pragma region Commands
+
+namespace XVBTProfilerCommands
+{
+	static void Dump(const TArray<FString>& Args)
+	{
+		int32 MaxRows = 30;
+		if (Args.Num() > 0)
+		{
+			LexFromString(MaxRows, *Args[0]);
+		}
+		FXVBTProfiler::Get().Dump(FMath::Max(MaxRows, 1));
+	}
+
+	static void ExportCSV(const TArray<FString>& Args)
+	{
+		const FString Path = Args.Num() > 0
+			? Args[0]
+			: FPaths::ProjectSavedDir() / TEXT("Profiling") / FString::Printf(TEXT("XVBTProfile_%s.csv"), *FDateTime::Now().ToString());
+		FXVBTProfiler::Get().ExportCSV(Path);
+	}
+
+	static FAutoConsoleCommand DumpCommand(
+		TEXT("XV.AI.BTProfiler.Dump"),
+		TEXT("BT 노드 프로파일 결과를 총 시간 순으로 출력. 인자: [출력 줄 수]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&Dump));
+
+	static FAutoConsoleCommand CSVCommand(
+		TEXT("XV.AI.BTProfiler.CSV"),
+		TEXT("BT 노드 프로파일 결과를 CSV 로 저장. 인자: [경로]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&ExportCSV));
+
+	static FAutoConsoleCommand ResetCommand(
+		TEXT("XV.AI.BTProfiler.Reset"),
+		TEXT("BT 노드 프로파일 누적값 초기화"),
+		FConsoleCommandDelegate::CreateStatic([]() { FXVBTProfiler::Get().Reset(); }));
+}
+
+#pragma endregion
+
+#endif
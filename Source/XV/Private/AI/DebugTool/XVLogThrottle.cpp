@@ -0,0 +1,41 @@
+﻿#include "AI/DebugTool/XVLogThrottle.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<float> CVarXVLogThrottleRate(
+	TEXT("XV.Log.ThrottleRate"),
+	2.f,
+	TEXT("호출 위치별 초당 허용 로그 수 (XV_LOG_THROTTLED)"));
+
+static TAutoConsoleVariable<int32> CVarXVLogThrottleBurst(
+	TEXT("XV.Log.ThrottleBurst"),
+	5,
+	TEXT("호출 위치별 연속 허용 로그 수 (XV_LOG_THROTTLED)"));
+
+bool FXVLogThrottle::TryConsume(int32& OutSuppressedCount)
+{
+	FScopeLock Lock(&Mutex);
+
+	const double Now = FPlatformTime::Seconds();
+	const double Burst = FMath::Max(1, CVarXVLogThrottleBurst.GetValueOnAnyThread());
+
+	// 첫 호출은 가득 찬 상태로 시작
+	if (Tokens < 0.0)
+	{
+		Tokens = Burst;
+		LastRefillTime = Now;
+	}
+
+	Tokens = FMath::Min(Burst, Tokens + (Now - LastRefillTime) * CVarXVLogThrottleRate.GetValueOnAnyThread());
+	LastRefillTime = Now;
+
+	if (Tokens < 1.0)
+	{
+		SuppressedCount++;
+		return false;
+	}
+
+	Tokens -= 1.0;
+	OutSuppressedCount = SuppressedCount;
+	SuppressedCount = 0;
+	return true;
+}
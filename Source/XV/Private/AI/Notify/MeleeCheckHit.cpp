@@ -1,24 +1,57 @@
 ﻿#include "AI/Notify/MeleeCheckHit.h"
+#include "XV.h"
 #include "AI/Character/Base/XVEnemyBase.h"
 #include "AI/Weapons/Melee/M_Base/AIWeaponMeleeBase.h"
+#include "Animation/AnimInstance.h"
+#include "Animation/AnimMontage.h"
 
 void UMeleeCheckHit::NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference)
 {
+	XV_SCOPE_CYCLE_COUNTER(STAT_XV_AnimNotify);
+
 	Super::NotifyBegin(MeshComp, Animation, TotalDuration, EventReference);
 
-	if (!MeshComp) return;
+	if (AAIWeaponMeleeBase* Weapon = GetMeleeWeapon(MeshComp))
+	{
+		Weapon->BeginMeleeWindow();
+	}
+}
 
-	// MeshComp의 Owner가 AI 캐릭터인지 판단
-	AActor* Owner = MeshComp->GetOwner();
-	if (!Owner) return;
+void UMeleeCheckHit::NotifyTick(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float FrameDeltaTime, const FAnimNotifyEventReference& EventReference)
+{
+	XV_SCOPE_CYCLE_COUNTER(STAT_XV_AnimNotify);
 
-	AXVEnemyBase* Enemy = Cast<AXVEnemyBase>(Owner);
-	if (!Enemy) return;
+	Super::NotifyTick(MeshComp, Animation, FrameDeltaTime, EventReference);
 
-	// 무기 오버랩 체크
-	if (Enemy->AIWeaponBase)
+	if (AAIWeaponMeleeBase* Weapon = GetMeleeWeapon(MeshComp))
 	{
-		CurrentWeapon = Cast<AAIWeaponMeleeBase>(Enemy->AIWeaponBase);
-		CurrentWeapon->CheckMeleeHit();
+		Weapon->TickMeleeWindow();
 	}
 }
+
+void UMeleeCheckHit::NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
+{
+	XV_SCOPE_CYCLE_COUNTER(STAT_XV_AnimNotify);
+
+	Super::NotifyEnd(MeshComp, Animation, EventReference);
+
+	if (AAIWeaponMeleeBase* Weapon = GetMeleeWeapon(MeshComp))
+	{
+		// 구간 끝 전에 몽타주가 멈췄다면(중단) 마지막 스윕 생략
+		const UAnimInstance* AnimInstance = MeshComp->GetAnimInstance();
+		const UAnimMontage* Montage = Cast<UAnimMontage>(Animation);
+		const bool bInterrupted = AnimInstance && Montage && AnimInstance->Montage_GetIsStopped(Montage);
+		Weapon->EndMeleeWindow(bInterrupted);
+	}
+}
+
+AAIWeaponMeleeBase* UMeleeCheckHit::GetMeleeWeapon(const USkeletalMeshComponent* MeshComp)
+{
+	if (!MeshComp) return nullptr;
+
+	// MeshComp의 Owner가 AI 캐릭터인지 판단
+	const AXVEnemyBase* Enemy = Cast<AXVEnemyBase>(MeshComp->GetOwner());
+	if (!Enemy) return nullptr;
+
+	return Cast<AAIWeaponMeleeBase>(Enemy->AIWeaponBase);
+}
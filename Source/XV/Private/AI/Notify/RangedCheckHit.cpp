@@ -1,13 +1,27 @@
 ﻿#include "AI/Notify/RangedCheckHit.h"
+#include "XV.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "AI/Character/Base/XVEnemyBase.h"
 #include "Character/XVCharacter.h"
 #include "AI/AIComponents/AIStatusComponent.h"
 #include "Engine/World.h"
 #include "DrawDebugHelpers.h"
+#include "System/XVRandomStreamSubsystem.h"
+#include "AI/Weapons/Gun/Base/AIWeaponGunBase.h"
+#include "Components/CapsuleComponent.h"
+
+URangedCheckHit::URangedCheckHit()
+{
+    // 기존 명중률(약 70%)과 비슷하게 맞춘 기본값
+    Spread.BaseSpreadDegrees = 2.5f;
+    Spread.MaxSpreadDegrees = 6.f;
+    Spread.RecoilPerShotDegrees = 0.75f;
+}
 
 void URangedCheckHit::NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference)
 {
+    XV_SCOPE_CYCLE_COUNTER(STAT_XV_AnimNotify);
+
     Super::NotifyBegin(MeshComp, Animation, TotalDuration, EventReference);
 
     if (!MeshComp) return;
@@ -57,6 +71,7 @@ void URangedCheckHit::NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenc
 
             // 라인트레이스로 캐릭터까지 중간에 막힌 게 있는지 체크
             FHitResult BlockCheckHit;
+            XV_COUNT_TRACE();
             bool bBlocked = Enemy->GetWorld()->LineTraceSingleByChannel(
                 BlockCheckHit,
                 TraceStart,
@@ -78,13 +93,41 @@ void URangedCheckHit::NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenc
                 continue; // 넘어감 (다음 캐릭터 Hit 검사)
             }
 
-            // (B) 명중 확률 체크
-            float RandomValue = FMath::FRand();
-            if (RandomValue < HitProbability)
+            // (B) 퍼짐 모델로 탄 방향 계산 (반동은 무기별 누적, 무기가 없으면 매번 초기 상태)
+            FXVSpreadState LocalSpreadState;
+            AAIWeaponGunBase* Gun = Cast<AAIWeaponGunBase>(Enemy->AIWeaponBase);
+            FXVSpreadState& SpreadState = Gun ? Gun->GetSpreadState() : LocalSpreadState;
+            const float HalfAngle = FXVSpreadModel::ConsumeShot(Spread, SpreadState, Enemy->GetWorld()->GetTimeSeconds());
+
+            TArray<FVector, TInlineAllocator<16>> Directions;
+            FXVSpreadModel::EvaluatePellets(TraceEnd - TraceStart, HalfAngle, Spread.PelletCount,
+                UXVRandomStreamSubsystem::GetStream(Enemy, UXVRandomStreamSubsystem::CombatDomain), Directions);
+
+            // (C) 탄마다 캡슐과 교차 여부 (시야는 위에서 확인했으므로 추가 트레이스 없이 계산)
+            const UCapsuleComponent* Capsule = Character->GetCapsuleComponent();
+            const float CapsuleRadius = Capsule->GetScaledCapsuleRadius();
+            const FVector CapsuleAxis = Capsule->GetUpVector() * FMath::Max(Capsule->GetScaledCapsuleHalfHeight() - CapsuleRadius, 0.f);
+            const FVector CapsuleCenter = Capsule->GetComponentLocation();
+            const float Distance = FVector::Dist(TraceStart, TraceEnd);
+            const float RayLength = Distance + CapsuleRadius * 2.f;
+
+            int32 NumPelletHits = 0;
+            for (const FVector& Direction : Directions)
+            {
+                FVector OnRay;
+                FVector OnAxis;
+                FMath::SegmentDistToSegmentSafe(TraceStart, TraceStart + Direction * RayLength, CapsuleCenter - CapsuleAxis, CapsuleCenter + CapsuleAxis, OnRay, OnAxis);
+                NumPelletHits += FVector::DistSquared(OnRay, OnAxis) <= FMath::Square(CapsuleRadius) ? 1 : 0;
+            }
+
+            if (NumPelletHits > 0)
             {
                 float Damage = 10.f;
                 if (UAIStatusComponent* Status = Enemy->FindComponentByClass<UAIStatusComponent>())
                     Damage = Status->AttackDamage;
+
+                // 맞은 탄 비율 x 거리 감쇠
+                Damage *= static_cast<float>(NumPelletHits) / Directions.Num() * FXVSpreadModel::GetDamageScale(Spread, Distance);
                 Character->AddDamage(Damage);
             }
             else
@@ -3,6 +3,7 @@
 
 #include "CoreMinimal.h"
 #include "Animation/AnimNotifies/AnimNotifyState.h"
+#include "XVSpread.h"
 #include "RangedCheckHit.generated.h"
 
 UCLASS()
@@ -12,6 +13,8 @@ class XV_API URangedCheckHit : public UAnimNotifyState
 	GENERATED_BODY()
 
 public:
+	URangedCheckHit();
+
 	// 애니메이션 노티파이 시 실행
 	virtual void NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference) override;
 
@@ -23,7 +26,7 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RangeTrace")
 	float TraceDistance = 3000.f;
 
-	// 명중 확률 (0.0~1.0)
+	// 탄 퍼짐 (플레이어 무기와 같은 모델, 캡슐에 맞은 탄 비율만큼 데미지)
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RangeTrace")
-	float HitProbability = 0.7f;
+	FXVSpreadParams Spread;
 };
\ No newline at end of file
@@ -1,4 +1,5 @@
 ﻿#include "AI/System/AIController/Base/XVControllerBase.h"
+#include "XV.h"
 #include "AI/DebugTool/DebugTool.h"
 #include "Perception/AIPerceptionComponent.h"
 #include "Perception/AISenseConfig_Sight.h"
@@ -8,9 +9,17 @@
 #include "AI/Character/Base/XVEnemyBase.h"
 #include "System/XVGameMode.h"
 #include "System/XVGameState.h"
+#include "AI/System/Perception/XVPerceptionRouterSubsystem.h"
+#include "AI/Data/Perception/XVPerceptionProfile.h"
+#include "AI/System/Target/XVTargetSelectionSubsystem.h"
 
 DEFINE_LOG_CATEGORY(Log_XV_AI);
 
+static TAutoConsoleVariable<bool> CVarXVDebugPerception(
+	TEXT("XV.AI.DebugPerception"),
+	false,
+	TEXT("AI 퍼셉션 감지/놓침 디버그 문자열 표시"));
+
 FGenericTeamId AXVControllerBase::GetGenericTeamId() const
 {
 	return Super::GetGenericTeamId();
@@ -63,18 +72,57 @@ AXVControllerBase::AXVControllerBase()
 	AIPerception->SetDominantSense(AISightConfig->GetSenseImplementation());
 }
 
+void AXVControllerBase::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	// 컴포넌트 등록(리스너 등록) 전에 프로필 값을 넣어 두면 스폰 시 재등록이 필요 없음
+	if (PerceptionProfile)
+	{
+		ApplyPerceptionProfile(PerceptionProfile, false);
+	}
+}
+
+void AXVControllerBase::ApplyPerceptionProfile(UXVPerceptionProfile* Profile, bool bRequestListenerUpdate)
+{
+	if (!Profile || !AISightConfig || !AIHearingConfig) return;
+
+	Profile->ApplyTo(*AISightConfig, *AIHearingConfig);
+	AppliedPerceptionProfile = Profile;
+
+	if (bRequestListenerUpdate && AIPerception)
+	{
+		AIPerception->RequestStimuliListenerUpdate();
+	}
+}
+
 void AXVControllerBase::OnPossess(APawn* InPawn)
 {
     Super::OnPossess(InPawn);
 
 	// 팀 아이디 설정
 	SetGenericTeamId(FGenericTeamId(TeamID)); 
+
+	// 웨이브 도중 새로 빙의한 경우에도 공격 모드 속도 적용
+	if (const AXVGameState* GameState = GetWorld()->GetGameState<AXVGameState>())
+	{
+		if (GameState->IsWaveTriggered())
+		{
+			if (AXVEnemyBase* Enemy = Cast<AXVEnemyBase>(InPawn))
+			{
+				Enemy->SetAttackMode();
+			}
+		}
+	}
 }
 
 void AXVControllerBase::BeginPlay()
 {
     Super::BeginPlay();
 
+	PerceptionRouter = GetWorld()->GetSubsystem<UXVPerceptionRouterSubsystem>();
+	TargetSelection = GetWorld()->GetSubsystem<UXVTargetSelectionSubsystem>();
+
 	// 플레이어 감지시 쓸 함수 바인딩
 	AIPerception->OnTargetPerceptionUpdated.AddDynamic(this,&AXVControllerBase::OnTargetInfoUpdated);
 
@@ -82,47 +130,56 @@ void AXVControllerBase::BeginPlay()
 	checkf(BehaviorTreeAsset != nullptr, TEXT("BehaviorTreeAsset is NULL"));
 	RunBehaviorTree(BehaviorTreeAsset);
 
+	// 웨이브 상태는 변경 알림으로만 받음 (매 틱 폴링 X)
+	if (AXVGameState* GameState = GetWorld()->GetGameState<AXVGameState>())
+	{
+		GameState->OnProgressChanged.AddDynamic(this, &AXVControllerBase::OnGameProgressChanged);
+
+		// 웨이브가 이미 시작된 뒤에 스폰된 경우
+		if (GameState->IsWaveTriggered())
+		{
+			EnterAttackMode();
+		}
+	}
+
 	// 로그 확인
 	LogDataAssetValues();
 }
 
 void AXVControllerBase::Tick(float DeltaSeconds)
 {
+	XV_SCOPE_CYCLE_COUNTER(STAT_XV_ControllerTick);
+
+	FXVStressAITickScope StressScope;
+
 	Super::Tick(DeltaSeconds);
 	
 	APawn* ControlledPawn = GetPawn();
+	if (!ControlledPawn || !AIBlackBoard) return;
+
 	FVector MyLocation = ControlledPawn->GetActorLocation();
 
 	//[1] 본인 위치 실시간 업데이트
 	AIBlackBoard->SetValueAsVector(TEXT("MyLocation"), MyLocation);
 
-	//[2] 플레이어 위치 업데이트
-	APlayerController* PC = GetWorld()->GetFirstPlayerController();
-	if (PC && PC->GetPawn())
+	//[2] 타겟 플레이어 위치 업데이트 (코옵: 가장 가깝거나 위협적인 플레이어)
+	if (TargetSelection)
 	{
-		FVector PlayerLocation = PC->GetPawn()->GetActorLocation();
-		AIBlackBoard->SetValueAsVector(TEXT("TargetLocation"), PlayerLocation);
-	}
-
-	// [3]게임 스테이트 정보 확인하기
-	if (AXVGameState* GameState = Cast<AXVGameState>(GetWorld()->GetGameState()))
-	{
-		// 공격 모드 상태이어야 하는지 확인
-		if (true == GameState->IsWaveTriggered)
+		if (const APawn* TargetPawn = TargetSelection->SelectTarget(MyLocation))
 		{
-			// 블랙보드에 공격 모드 세팅 설정
-			AIBlackBoard->SetValueAsBool(TEXT("AIIsAttacking"), true);
-
-			//공격 모드 속도로 변경
-			if (AXVEnemyBase* Enemy = Cast<AXVEnemyBase>( GetPawn()))
-			{
-				Enemy->SetAttackMode();
-			}
+			AIBlackBoard->SetValueAsVector(TEXT("TargetLocation"), TargetPawn->GetActorLocation());
 		}
 	}
 }
 
 
+FPathFollowingRequestResult AXVControllerBase::MoveTo(const FAIMoveRequest& MoveRequest, FNavPathSharedPtr* OutPath)
+{
+	XV_COUNT_NAV_REQUEST();
+
+	return Super::MoveTo(MoveRequest, OutPath);
+}
+
 void AXVControllerBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	if (AIPerception && IsValid(AIPerception))
@@ -131,23 +188,49 @@ void AXVControllerBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
 		AIPerception->OnTargetPerceptionUpdated.RemoveAll(this);
 	}
 
+	if (AXVGameState* GameState = GetWorld()->GetGameState<AXVGameState>())
+	{
+		GameState->OnProgressChanged.RemoveAll(this);
+	}
+
 	Super::EndPlay(EndPlayReason);
 }
 
+void AXVControllerBase::OnGameProgressChanged(const FXVGameProgress& NewProgress, const FXVGameProgress& OldProgress)
+{
+	// 웨이브가 막 시작된 순간에만 반응
+	if (NewProgress.bIsWaveTriggered && !OldProgress.bIsWaveTriggered)
+	{
+		EnterAttackMode();
+	}
+}
+
+void AXVControllerBase::EnterAttackMode()
+{
+	// 블랙보드에 공격 모드 세팅 설정
+	if (AIBlackBoard)
+	{
+		AIBlackBoard->SetValueAsBool(TEXT("AIIsAttacking"), true);
+	}
+
+	//공격 모드 속도로 변경
+	if (AXVEnemyBase* Enemy = Cast<AXVEnemyBase>(GetPawn()))
+	{
+		Enemy->SetAttackMode();
+	}
+}
+
 void AXVControllerBase::OnTargetInfoUpdated(AActor* Actor, FAIStimulus Stimulus)
 {
-	// 액터 감지 되지 않았거나 블랙보드 없는지 확인
-    if (!Actor || !AIBlackBoard)
-    {
-        return;
-    }
-
-    // 플레이어 캐릭터인지 확인
-    ACharacter* PlayerCharacter = UGameplayStatics::GetPlayerCharacter(GetWorld(), 0);
-	if (Actor != PlayerCharacter)
-    {
-        return;
-    }
+	XV_SCOPE_CYCLE_COUNTER(STAT_XV_Perception);
+
+	FXVStressAITickScope StressScope;
+
+	// 플레이어가 아닌 자극은 다른 작업 전에 바로 걸러냄
+	if (!PerceptionRouter || !PerceptionRouter->IsPlayerTarget(Actor) || !AIBlackBoard)
+	{
+		return;
+	}
 
     // 감지 상태 확인
     const bool bWasSuccessfullySensed = Stimulus.WasSuccessfullySensed();
@@ -162,41 +245,35 @@ void AXVControllerBase::OnTargetInfoUpdated(AActor* Actor, FAIStimulus Stimulus)
 	{
 		Enemy->SetAttackMode();
 	}
-	
-    // 디버그 정보 출력
-    const FString StatusText = bWasSuccessfullySensed ? FString::Printf(TEXT("Saw: %s"), *Actor->GetName()) : FString::Printf(TEXT("Lost: %s"), *Actor->GetName());
-    DrawDebugString(GetWorld(), Actor->GetActorLocation() + FVector(0, 0, 100), StatusText, nullptr, bWasSuccessfullySensed ? FColor::Green : FColor::Red, 2.0f,true);
-	
-	// 게임모드 업데이트
-	if (AXVGameMode* GameMode = Cast<AXVGameMode>(GetWorld()->GetAuthGameMode()))
+
+#if ENABLE_DRAW_DEBUG
+    // 디버그 정보 출력 (XV.AI.DebugPerception 1 일 때만 문자열 생성)
+	if (CVarXVDebugPerception.GetValueOnGameThread())
 	{
-		GameMode->OnWaveTriggered();
+		const FString StatusText = bWasSuccessfullySensed ? FString::Printf(TEXT("Saw: %s"), *Actor->GetName()) : FString::Printf(TEXT("Lost: %s"), *Actor->GetName());
+		DrawDebugString(GetWorld(), Actor->GetActorLocation() + FVector(0, 0, 100), StatusText, nullptr, bWasSuccessfullySensed ? FColor::Green : FColor::Red, 2.0f,true);
 	}
+#endif
+	
+	// 게임모드 업데이트 (같은 프레임의 발견은 라우터에서 한 번으로 묶음)
+	PerceptionRouter->NotifyPlayerSpotted();
 }
 
 void AXVControllerBase::LogDataAssetValues() const
 {
-	// 소유 테스트 확인
-	
-	// Sight Config 적용된 값 확인
-	UE_LOG(LogTemp, Warning, TEXT("--- Sight Configuration ---"));
-	UE_LOG(LogTemp, Warning, TEXT("Sight Radius: %.2f"), AISightConfig->SightRadius);
-	UE_LOG(LogTemp, Warning, TEXT("Lose Sight Radius: %.2f"), AISightConfig->LoseSightRadius);
-	UE_LOG(LogTemp, Warning, TEXT("Peripheral Vision Angle: %.2f"), AISightConfig->PeripheralVisionAngleDegrees);
-
-	// Hearing Config 적용된 값 확인
-	UE_LOG(LogTemp, Warning, TEXT("--- Hearing Configuration ---"));
-	UE_LOG(LogTemp, Warning, TEXT("Hearing Range: %.2f"), AIHearingConfig->HearingRange);
-
-	// 적용된 감지 설정 확인
-	UE_LOG(LogTemp, Warning, TEXT("--- Detection Settings ---"));
-	UE_LOG(LogTemp, Warning, TEXT("Sight - Detect Enemies: %s"), AISightConfig->DetectionByAffiliation.bDetectEnemies ? TEXT("True") : TEXT("False"));
-	UE_LOG(LogTemp, Warning, TEXT("Sight - Detect Neutrals: %s"), AISightConfig->DetectionByAffiliation.bDetectNeutrals ? TEXT("True") : TEXT("False"));
-	UE_LOG(LogTemp, Warning, TEXT("Sight - Detect Friendlies: %s"), AISightConfig->DetectionByAffiliation.bDetectFriendlies ? TEXT("True") : TEXT("False"));
-    
-	UE_LOG(LogTemp, Warning, TEXT("Hearing - Detect Enemies: %s"), AIHearingConfig->DetectionByAffiliation.bDetectEnemies ? TEXT("True") : TEXT("False"));
-	UE_LOG(LogTemp, Warning, TEXT("Hearing - Detect Neutrals: %s"), AIHearingConfig->DetectionByAffiliation.bDetectNeutrals ? TEXT("True") : TEXT("False"));
-	UE_LOG(LogTemp, Warning, TEXT("Hearing - Detect Friendlies: %s"), AIHearingConfig->DetectionByAffiliation.bDetectFriendlies ? TEXT("True") : TEXT("False"));
+	// 적마다 스폰 시 출력되므로 Verbose 에서만 (Log Log_XV_AI Verbose), 한 줄로 묶어서 출력
+	if (!UE_LOG_ACTIVE(Log_XV_AI, Verbose)) return;
 
-	
-} // DataAsset 값들을 로그로 출력하는 함수
\ No newline at end of file
+	UE_LOG(Log_XV_AI, Verbose, TEXT("[%s] Sight(Radius=%.0f Lose=%.0f Angle=%.0f Enemies=%d Neutrals=%d Friendlies=%d) Hearing(Range=%.0f Enemies=%d Neutrals=%d Friendlies=%d)"),
+		*GetNameSafe(GetPawn()),
+		AISightConfig->SightRadius,
+		AISightConfig->LoseSightRadius,
+		AISightConfig->PeripheralVisionAngleDegrees,
+		AISightConfig->DetectionByAffiliation.bDetectEnemies,
+		AISightConfig->DetectionByAffiliation.bDetectNeutrals,
+		AISightConfig->DetectionByAffiliation.bDetectFriendlies,
+		AIHearingConfig->HearingRange,
+		AIHearingConfig->DetectionByAffiliation.bDetectEnemies,
+		AIHearingConfig->DetectionByAffiliation.bDetectNeutrals,
+		AIHearingConfig->DetectionByAffiliation.bDetectFriendlies);
+} // DataAsset 값들을 로그로 출력하는 함수
@@ -0,0 +1,240 @@
+﻿#include "AI/System/Animation/XVEnemyAnimBudgetSubsystem.h"
+#include "XV.h"
+#include "AI/Character/Base/XVEnemyBase.h"
+#include "AI/System/Target/XVTargetSelectionSubsystem.h"
+#include "AI/Weapons/Melee/M_Base/AIWeaponMeleeBase.h"
+#include "Animation/AnimInstance.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Camera/PlayerCameraManager.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+
+static TAutoConsoleVariable<bool> CVarXVAnimBudget(
+	TEXT("XV.AI.AnimBudget"),
+	true,
+	TEXT("적 애니메이션 예산 사용 여부 (끄면 모두 매 프레임 갱신)"));
+
+static TAutoConsoleVariable<float> CVarXVAnimBudgetUpdateInterval(
+	TEXT("XV.AI.AnimBudget.UpdateInterval"),
+	0.25f,
+	TEXT("중요도/등급 재계산 주기 (초)"));
+
+static TAutoConsoleVariable<int32> CVarXVAnimBudgetFullRateCount(
+	TEXT("XV.AI.AnimBudget.FullRateCount"),
+	40,
+	TEXT("중요도 상위 몇 명을 매 프레임 갱신할지 (전투 중인 적은 별도로 항상 포함)"));
+
+static TAutoConsoleVariable<float> CVarXVAnimBudgetCombatDistance(
+	TEXT("XV.AI.AnimBudget.CombatDistance"),
+	1500.f,
+	TEXT("플레이어가 이 거리 안이면 전투 중으로 보고 매 프레임 갱신"));
+
+static TAutoConsoleVariable<float> CVarXVAnimBudgetMidDistance(
+	TEXT("XV.AI.AnimBudget.MidDistance"),
+	3000.f,
+	TEXT("이 중요도 거리 안이면 Half(30Hz), 밖이면 Quarter(15Hz)"));
+
+static TAutoConsoleVariable<float> CVarXVAnimBudgetFarDistance(
+	TEXT("XV.AI.AnimBudget.FarDistance"),
+	6000.f,
+	TEXT("이 중요도 거리 밖이면 Minimal(8Hz)"));
+
+static TAutoConsoleVariable<float> CVarXVAnimBudgetHiddenScale(
+	TEXT("XV.AI.AnimBudget.HiddenScale"),
+	3.f,
+	TEXT("최근 렌더링되지 않은 적의 중요도 거리 배율"));
+
+namespace XVAnimBudget
+{
+	// 등급별 메쉬 틱 간격 (0 = 매 프레임)
+	static float GetTickInterval(EXVAnimBudgetTier Tier)
+	{
+		switch (Tier)
+		{
+		case EXVAnimBudgetTier::Half:    return 1.f / 30.f;
+		case EXVAnimBudgetTier::Quarter: return 1.f / 15.f;
+		case EXVAnimBudgetTier::Minimal: return 1.f / 8.f;
+		default:                         return 0.f;
+		}
+	}
+}
+
+void UXVEnemyAnimBudgetSubsystem::Tick(float DeltaTime)
+{
+	XV_SCOPE_CYCLE_COUNTER(STAT_XV_AISubsystems);
+
+	FXVStressAITickScope StressScope;
+
+	Super::Tick(DeltaTime);
+
+	TimeUntilUpdate -= DeltaTime;
+	if (TimeUntilUpdate > 0.f) return;
+	TimeUntilUpdate = CVarXVAnimBudgetUpdateInterval.GetValueOnGameThread();
+
+	Entries.RemoveAllSwap([](const FXVAnimBudgetEntry& Entry) { return !Entry.Enemy.IsValid(); }, EAllowShrinking::No);
+	if (Entries.IsEmpty()) return;
+
+	// 꺼져 있으면 전부 매 프레임으로 되돌림
+	if (!CVarXVAnimBudget.GetValueOnGameThread())
+	{
+		for (FXVAnimBudgetEntry& Entry : Entries)
+		{
+			ApplyTier(Entry, EXVAnimBudgetTier::Full, true);
+		}
+		return;
+	}
+
+	UpdateSignificance();
+	AssignTiers();
+}
+
+TStatId UXVEnemyAnimBudgetSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UXVEnemyAnimBudgetSubsystem, STATGROUP_Tickables);
+}
+
+bool UXVEnemyAnimBudgetSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UXVEnemyAnimBudgetSubsystem::RegisterEnemy(AXVEnemyBase* Enemy)
+{
+	if (!Enemy || !Enemy->GetMesh()) return;
+	if (Entries.ContainsByPredicate([Enemy](const FXVAnimBudgetEntry& Entry) { return Entry.Enemy == Enemy; })) return;
+
+	FXVAnimBudgetEntry& Entry = Entries.AddDefaulted_GetRef();
+	Entry.Enemy = Enemy;
+
+	// 다음 틱에 바로 등급 계산
+	TimeUntilUpdate = 0.f;
+}
+
+void UXVEnemyAnimBudgetSubsystem::UnregisterEnemy(AXVEnemyBase* Enemy)
+{
+	const int32 Index = Entries.IndexOfByPredicate([Enemy](const FXVAnimBudgetEntry& Entry) { return Entry.Enemy == Enemy; });
+	if (Index != INDEX_NONE)
+	{
+		Entries.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	}
+}
+
+void UXVEnemyAnimBudgetSubsystem::UpdateSignificance()
+{
+	// 로컬 카메라 위치 (분할 화면 대비 여러 개)
+	ViewLocations.Reset();
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (PC && PC->IsLocalController() && PC->PlayerCameraManager)
+		{
+			ViewLocations.Add(PC->PlayerCameraManager->GetCameraLocation());
+		}
+	}
+
+	const UXVTargetSelectionSubsystem* TargetSelection = GetWorld()->GetSubsystem<UXVTargetSelectionSubsystem>();
+	const float CombatDistance = CVarXVAnimBudgetCombatDistance.GetValueOnGameThread();
+	const float HiddenScale = CVarXVAnimBudgetHiddenScale.GetValueOnGameThread();
+
+	for (FXVAnimBudgetEntry& Entry : Entries)
+	{
+		const AXVEnemyBase* Enemy = Entry.Enemy.Get();
+		const FVector Location = Enemy->GetActorLocation();
+
+		float MinDistSq = ViewLocations.IsEmpty() ? 0.f : UE_BIG_NUMBER;
+		for (const FVector& ViewLocation : ViewLocations)
+		{
+			MinDistSq = FMath::Min(MinDistSq, static_cast<float>(FVector::DistSquared(ViewLocation, Location)));
+		}
+
+		// 거리가 가까울수록 중요 (값이 작을수록 우선)
+		float Significance = FMath::Sqrt(MinDistSq);
+		if (!Enemy->WasRecentlyRendered(0.2f))
+		{
+			Significance *= HiddenScale;
+		}
+
+		Entry.Significance = Significance;
+		Entry.bCombat = IsInCombat(*Enemy, Location, TargetSelection, CombatDistance);
+	}
+}
+
+void UXVEnemyAnimBudgetSubsystem::AssignTiers()
+{
+	SortedIndices.SetNumUninitialized(Entries.Num());
+	for (int32 Index = 0; Index < Entries.Num(); ++Index)
+	{
+		SortedIndices[Index] = Index;
+	}
+	SortedIndices.Sort([this](int32 A, int32 B) { return Entries[A].Significance < Entries[B].Significance; });
+
+	const int32 FullRateCount = CVarXVAnimBudgetFullRateCount.GetValueOnGameThread();
+	const float MidDistance = CVarXVAnimBudgetMidDistance.GetValueOnGameThread();
+	const float FarDistance = CVarXVAnimBudgetFarDistance.GetValueOnGameThread();
+
+	for (int32 Rank = 0; Rank < SortedIndices.Num(); ++Rank)
+	{
+		FXVAnimBudgetEntry& Entry = Entries[SortedIndices[Rank]];
+
+		EXVAnimBudgetTier NewTier;
+		if (Entry.bCombat || Rank < FullRateCount)
+		{
+			NewTier = EXVAnimBudgetTier::Full;
+		}
+		else if (Entry.Significance < MidDistance)
+		{
+			NewTier = EXVAnimBudgetTier::Half;
+		}
+		else if (Entry.Significance < FarDistance)
+		{
+			NewTier = EXVAnimBudgetTier::Quarter;
+		}
+		else
+		{
+			NewTier = EXVAnimBudgetTier::Minimal;
+		}
+
+		ApplyTier(Entry, NewTier, Entry.bCombat);
+	}
+}
+
+void UXVEnemyAnimBudgetSubsystem::ApplyTier(FXVAnimBudgetEntry& Entry, EXVAnimBudgetTier NewTier, bool bAlwaysTickPose)
+{
+	if (Entry.bApplied && Entry.Tier == NewTier && Entry.bAlwaysTickPose == bAlwaysTickPose) return;
+
+	USkeletalMeshComponent* Mesh = Entry.Enemy->GetMesh();
+	if (!Mesh) return;
+
+	// 건너뛴 시간은 다음 틱 DeltaTime 에 합쳐지므로 노티파이가 누락되지 않음
+	Mesh->SetComponentTickInterval(XVAnimBudget::GetTickInterval(NewTier));
+
+	// 전투 중이면 화면 밖이어도 본 갱신 (무기 소켓/판정 위치 유지)
+	Mesh->VisibilityBasedAnimTickOption = bAlwaysTickPose
+		? EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones
+		: EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered;
+
+	// 전투 중에는 URO 프레임 스킵도 끔 (공격 판정 노티파이가 밀리지 않도록)
+	Mesh->bEnableUpdateRateOptimizations = !bAlwaysTickPose;
+
+	Entry.Tier = NewTier;
+	Entry.bAlwaysTickPose = bAlwaysTickPose;
+	Entry.bApplied = true;
+}
+
+bool UXVEnemyAnimBudgetSubsystem::IsInCombat(const AXVEnemyBase& Enemy, const FVector& Location, const UXVTargetSelectionSubsystem* TargetSelection, float CombatDistance)
+{
+	// 근접 판정 구간 진행 중
+	if (const AAIWeaponMeleeBase* MeleeWeapon = Cast<AAIWeaponMeleeBase>(Enemy.AIWeaponBase))
+	{
+		if (MeleeWeapon->IsMeleeWindowActive()) return true;
+	}
+
+	// 공격/피격 몽타주 재생 중
+	if (const UAnimInstance* AnimInstance = Enemy.GetMesh()->GetAnimInstance())
+	{
+		if (AnimInstance->IsAnyMontagePlaying()) return true;
+	}
+
+	// 플레이어 근처
+	return TargetSelection && TargetSelection->FindNearestTarget(Location, CombatDistance) != nullptr;
+}
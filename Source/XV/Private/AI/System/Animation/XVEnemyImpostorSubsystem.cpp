@@ -0,0 +1,312 @@
+﻿#include "AI/System/Animation/XVEnemyImpostorSubsystem.h"
+#include "XV.h"
+#include "AI/Character/Base/XVEnemyBase.h"
+#include "AI/AIComponents/AIConfigComponent.h"
+#include "AI/Weapons/Base/AIWeaponBase.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Camera/PlayerCameraManager.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+
+static TAutoConsoleVariable<bool> CVarXVImpostor(
+	TEXT("XV.AI.Impostor"),
+	true,
+	TEXT("원거리 적 임포스터 사용 여부 (끄면 모두 스켈레탈 메쉬로 복귀)"));
+
+static TAutoConsoleVariable<float> CVarXVImpostorDistanceScale(
+	TEXT("XV.AI.Impostor.DistanceScale"),
+	1.f,
+	TEXT("적 타입별 ImpostorDistance 배율 (하드웨어 등급별 조절용)"));
+
+static TAutoConsoleVariable<float> CVarXVImpostorHysteresis(
+	TEXT("XV.AI.Impostor.Hysteresis"),
+	0.1f,
+	TEXT("스켈레탈 메쉬로 복귀하는 거리 = ImpostorDistance * (1 - 이 값), 경계에서 깜빡임 방지"));
+
+static TAutoConsoleVariable<float> CVarXVImpostorUpdateInterval(
+	TEXT("XV.AI.Impostor.UpdateInterval"),
+	0.2f,
+	TEXT("전환/애니메이션 상태 재계산 주기 (초)"));
+
+namespace XVImpostor
+{
+	static constexpr int32 NumCustomData = 4;
+	// 이 속도 이상이면 이동 애니메이션
+	static constexpr float MoveSpeedThreshold = 10.f;
+	// 재생 배율 양자화 (조금씩 바뀔 때마다 렌더 상태를 갱신하지 않도록)
+	static constexpr float PlayRateStep = 0.1f;
+}
+
+void UXVEnemyImpostorSubsystem::Tick(float DeltaTime)
+{
+	XV_SCOPE_CYCLE_COUNTER(STAT_XV_AISubsystems);
+
+	FXVStressAITickScope StressScope;
+
+	Super::Tick(DeltaTime);
+
+	if (Agents.IsEmpty()) return;
+
+	TimeUntilUpdate -= DeltaTime;
+	if (TimeUntilUpdate <= 0.f)
+	{
+		TimeUntilUpdate = CVarXVImpostorUpdateInterval.GetValueOnGameThread();
+		UpdateRepresentations();
+	}
+
+	UpdateInstanceTransforms();
+}
+
+TStatId UXVEnemyImpostorSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UXVEnemyImpostorSubsystem, STATGROUP_Tickables);
+}
+
+bool UXVEnemyImpostorSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UXVEnemyImpostorSubsystem::Deinitialize()
+{
+	// 월드와 함께 컴포넌트/액터가 정리되므로 참조만 해제
+	Agents.Empty();
+	Batches.Empty();
+	ImpostorActor = nullptr;
+
+	Super::Deinitialize();
+}
+
+void UXVEnemyImpostorSubsystem::RegisterEnemy(AXVEnemyBase* Enemy)
+{
+	if (!Enemy) return;
+
+	const UAIConfigComponent* Config = Enemy->GetAIConfigComponent();
+	if (!Config || !Config->bUseImpostor || !Config->ImpostorMesh) return;
+	if (Agents.ContainsByPredicate([Enemy](const FXVImpostorAgent& Agent) { return Agent.Enemy == Enemy; })) return;
+
+	FXVImpostorAgent& Agent = Agents.AddDefaulted_GetRef();
+	Agent.Enemy = Enemy;
+	Agent.Mesh = Config->ImpostorMesh;
+	// 이름 해시로 위상을 흩뜨림 (같은 프레임에 스폰된 무리가 똑같이 움직이지 않도록)
+	Agent.PhaseOffset = static_cast<float>(GetTypeHash(Enemy->GetFName()) % 1024) / 1024.f;
+}
+
+void UXVEnemyImpostorSubsystem::UnregisterEnemy(AXVEnemyBase* Enemy)
+{
+	const int32 Index = Agents.IndexOfByPredicate([Enemy](const FXVImpostorAgent& Agent) { return Agent.Enemy == Enemy; });
+	if (Index == INDEX_NONE) return;
+
+	if (Agents[Index].IsImpostor())
+	{
+		ExitImpostor(Agents[Index]);
+	}
+	Agents.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+int32 UXVEnemyImpostorSubsystem::GetNumImpostors() const
+{
+	int32 Count = 0;
+	for (const TPair<TObjectPtr<UStaticMesh>, FXVImpostorBatch>& Pair : Batches)
+	{
+		Count += Pair.Value.InstanceOwners.Num();
+	}
+	return Count;
+}
+
+void UXVEnemyImpostorSubsystem::UpdateRepresentations()
+{
+	// 로컬 카메라 위치 (분할 화면 대비 여러 개)
+	ViewLocations.Reset();
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (PC && PC->IsLocalController() && PC->PlayerCameraManager)
+		{
+			ViewLocations.Add(PC->PlayerCameraManager->GetCameraLocation());
+		}
+	}
+
+	const bool bEnabled = CVarXVImpostor.GetValueOnGameThread() && !ViewLocations.IsEmpty();
+	const float DistanceScale = CVarXVImpostorDistanceScale.GetValueOnGameThread();
+	const float ReturnScale = 1.f - FMath::Clamp(CVarXVImpostorHysteresis.GetValueOnGameThread(), 0.f, 0.9f);
+
+	for (FXVImpostorAgent& Agent : Agents)
+	{
+		AXVEnemyBase* Enemy = Agent.Enemy.Get();
+		if (!Enemy || !Agent.Mesh.IsValid()) continue;
+
+		if (!bEnabled)
+		{
+			if (Agent.IsImpostor())
+			{
+				ExitImpostor(Agent);
+			}
+			continue;
+		}
+
+		const FVector Location = Enemy->GetActorLocation();
+		float MinDistSq = UE_BIG_NUMBER;
+		for (const FVector& ViewLocation : ViewLocations)
+		{
+			MinDistSq = FMath::Min(MinDistSq, static_cast<float>(FVector::DistSquared(ViewLocation, Location)));
+		}
+
+		const float ImpostorDistance = Enemy->GetAIConfigComponent()->ImpostorDistance * DistanceScale;
+		if (Agent.IsImpostor())
+		{
+			if (MinDistSq < FMath::Square(ImpostorDistance * ReturnScale))
+			{
+				ExitImpostor(Agent);
+			}
+			else
+			{
+				WriteCustomData(Agent, false);
+			}
+		}
+		else if (MinDistSq > FMath::Square(ImpostorDistance))
+		{
+			EnterImpostor(Agent);
+		}
+	}
+}
+
+void UXVEnemyImpostorSubsystem::UpdateInstanceTransforms()
+{
+	for (TPair<TObjectPtr<UStaticMesh>, FXVImpostorBatch>& Pair : Batches)
+	{
+		FXVImpostorBatch& Batch = Pair.Value;
+		if (Batch.InstanceOwners.IsEmpty() || !Batch.Component) continue;
+
+		Batch.Transforms.SetNumUninitialized(Batch.InstanceOwners.Num(), EAllowShrinking::No);
+		for (int32 Index = 0; Index < Batch.InstanceOwners.Num(); ++Index)
+		{
+			// 숨긴 스켈레탈 메쉬도 캡슐을 따라 움직이므로 그 위치를 그대로 사용
+			const AXVEnemyBase* Enemy = Batch.InstanceOwners[Index].Get();
+			Batch.Transforms[Index] = Enemy ? Enemy->GetMesh()->GetComponentTransform() : FTransform(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector);
+		}
+
+		// 메쉬당 한 번만 렌더 상태 갱신
+		Batch.Component->BatchUpdateInstancesTransforms(0, Batch.Transforms, true, true, false);
+	}
+}
+
+void UXVEnemyImpostorSubsystem::EnterImpostor(FXVImpostorAgent& Agent)
+{
+	AXVEnemyBase* Enemy = Agent.Enemy.Get();
+	FXVImpostorBatch* Batch = FindOrCreateBatch(Agent.Mesh.Get());
+	if (!Enemy || !Batch) return;
+
+	Agent.InstanceIndex = Batch->Component->AddInstance(Enemy->GetMesh()->GetComponentTransform(), true);
+	check(Agent.InstanceIndex == Batch->InstanceOwners.Num());
+	Batch->InstanceOwners.Add(Enemy);
+
+	WriteCustomData(Agent, true);
+	SetSkeletalVisible(*Enemy, false);
+}
+
+void UXVEnemyImpostorSubsystem::ExitImpostor(FXVImpostorAgent& Agent)
+{
+	FXVImpostorBatch* Batch = Batches.Find(Agent.Mesh.Get());
+	if (Batch && Batch->InstanceOwners.IsValidIndex(Agent.InstanceIndex))
+	{
+		// ISM 은 마지막 인스턴스를 빈 자리로 옮김 (bSupportRemoveAtSwap) → 소유자 목록도 똑같이 맞춤
+		const int32 RemovedIndex = Agent.InstanceIndex;
+		Batch->Component->RemoveInstance(RemovedIndex);
+		Batch->InstanceOwners.RemoveAtSwap(RemovedIndex, 1, EAllowShrinking::No);
+
+		if (Batch->InstanceOwners.IsValidIndex(RemovedIndex))
+		{
+			const TWeakObjectPtr<AXVEnemyBase>& MovedOwner = Batch->InstanceOwners[RemovedIndex];
+			if (FXVImpostorAgent* MovedAgent = Agents.FindByPredicate([&MovedOwner](const FXVImpostorAgent& Other) { return Other.Enemy == MovedOwner; }))
+			{
+				MovedAgent->InstanceIndex = RemovedIndex;
+			}
+		}
+	}
+
+	Agent.InstanceIndex = INDEX_NONE;
+
+	if (AXVEnemyBase* Enemy = Agent.Enemy.Get())
+	{
+		SetSkeletalVisible(*Enemy, true);
+	}
+}
+
+void UXVEnemyImpostorSubsystem::WriteCustomData(FXVImpostorAgent& Agent, bool bForce)
+{
+	const AXVEnemyBase* Enemy = Agent.Enemy.Get();
+	FXVImpostorBatch* Batch = Batches.Find(Agent.Mesh.Get());
+	if (!Enemy || !Batch || !Agent.IsImpostor()) return;
+
+	const UAIConfigComponent* Config = Enemy->GetAIConfigComponent();
+	const float Speed = Enemy->GetVelocity().Size2D();
+	const bool bMoving = Speed > XVImpostor::MoveSpeedThreshold;
+	const float PlayRate = bMoving
+		? FMath::Max(FMath::GridSnap(Speed / Config->ImpostorMoveReferenceSpeed, XVImpostor::PlayRateStep), XVImpostor::PlayRateStep)
+		: 1.f;
+
+	if (!bForce && Agent.bMoving == bMoving && FMath::IsNearlyEqual(Agent.PlayRate, PlayRate)) return;
+
+	Agent.bMoving = bMoving;
+	Agent.PlayRate = PlayRate;
+
+	const FIntPoint& Frames = bMoving ? Config->ImpostorMoveFrames : Config->ImpostorIdleFrames;
+	const float CustomData[XVImpostor::NumCustomData] =
+	{
+		static_cast<float>(Frames.X),
+		static_cast<float>(FMath::Max(Frames.Y, 1)),
+		Agent.PhaseOffset,
+		PlayRate,
+	};
+	Batch->Component->SetCustomData(Agent.InstanceIndex, CustomData, true);
+}
+
+FXVImpostorBatch* UXVEnemyImpostorSubsystem::FindOrCreateBatch(UStaticMesh* Mesh)
+{
+	if (!Mesh) return nullptr;
+
+	if (FXVImpostorBatch* Batch = Batches.Find(Mesh))
+	{
+		return Batch;
+	}
+
+	if (!ImpostorActor)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.ObjectFlags |= RF_Transient;
+		ImpostorActor = GetWorld()->SpawnActor<AActor>(SpawnParams);
+		if (!ImpostorActor) return nullptr;
+
+		USceneComponent* Root = NewObject<USceneComponent>(ImpostorActor, TEXT("Root"));
+		ImpostorActor->SetRootComponent(Root);
+		Root->RegisterComponent();
+	}
+
+	UInstancedStaticMeshComponent* Component = NewObject<UInstancedStaticMeshComponent>(ImpostorActor);
+	Component->SetStaticMesh(Mesh);
+	Component->SetNumCustomDataFloats(XVImpostor::NumCustomData);
+	Component->bSupportRemoveAtSwap = true;
+	// 멀리 있는 적만 그리므로 충돌/그림자 불필요
+	Component->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Component->SetCastShadow(false);
+	Component->SetupAttachment(ImpostorActor->GetRootComponent());
+	Component->RegisterComponent();
+
+	FXVImpostorBatch& Batch = Batches.Add(Mesh);
+	Batch.Component = Component;
+	return &Batch;
+}
+
+void UXVEnemyImpostorSubsystem::SetSkeletalVisible(AXVEnemyBase& Enemy, bool bVisible)
+{
+	// 메쉬는 숨기기만 하고 틱은 유지 (몽타주/노티파이는 계속 진행)
+	Enemy.GetMesh()->SetHiddenInGame(!bVisible);
+
+	if (Enemy.AIWeaponBase)
+	{
+		Enemy.AIWeaponBase->SetActorHiddenInGame(!bVisible);
+	}
+}
@@ -0,0 +1,171 @@
+﻿#include "AI/System/Crowd/XVCrowdAvoidanceSubsystem.h"
+#include "XV.h"
+#include "AI/System/Spatial/XVEnemySpatialGridSubsystem.h"
+#include "AI/Character/Base/XVEnemyBase.h"
+#include "AI/AIComponents/AIConfigComponent.h"
+#include "AI/AIComponents/XVEnemyMovementComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "Async/ParallelFor.h"
+
+static TAutoConsoleVariable<bool> CVarXVCrowdAvoidance(
+	TEXT("XV.AI.CrowdAvoidance"),
+	true,
+	TEXT("적 군중 회피 사용 여부"));
+
+static TAutoConsoleVariable<int32> CVarXVCrowdParallelMinAgents(
+	TEXT("XV.AI.CrowdParallelMinAgents"),
+	32,
+	TEXT("이 수 이상일 때만 회피 계산을 병렬로 처리"));
+
+void UXVCrowdAvoidanceSubsystem::Tick(float DeltaTime)
+{
+	XV_SCOPE_CYCLE_COUNTER(STAT_XV_AISubsystems);
+
+	FXVStressAITickScope StressScope;
+
+	Super::Tick(DeltaTime);
+
+	Agents.RemoveAllSwap([](const TWeakObjectPtr<AXVEnemyBase>& Agent) { return !Agent.IsValid(); }, EAllowShrinking::No);
+	if (Agents.IsEmpty()) return;
+
+	const UXVEnemySpatialGridSubsystem* SpatialGrid = GetWorld()->GetSubsystem<UXVEnemySpatialGridSubsystem>();
+	if (!SpatialGrid || !CVarXVCrowdAvoidance.GetValueOnGameThread())
+	{
+		for (const TWeakObjectPtr<AXVEnemyBase>& Agent : Agents)
+		{
+			if (UXVEnemyMovementComponent* Movement = Cast<UXVEnemyMovementComponent>(Agent->GetCharacterMovement()))
+			{
+				Movement->ClearCrowdAvoidanceVelocity();
+			}
+		}
+		return;
+	}
+
+	// [1] 게임 스레드에서 필요한 값 복사
+	GatherNeighborSnapshot(*SpatialGrid);
+
+	AgentSnapshots.Reset(Agents.Num());
+	for (const TWeakObjectPtr<AXVEnemyBase>& Agent : Agents)
+	{
+		const AXVEnemyBase* Enemy = Agent.Get();
+		const UAIConfigComponent* Config = Enemy->GetAIConfigComponent();
+		const UCharacterMovementComponent* Movement = Enemy->GetCharacterMovement();
+
+		FXVCrowdAgentSnapshot& Snapshot = AgentSnapshots.AddDefaulted_GetRef();
+		Snapshot.Location = Enemy->GetActorLocation();
+		Snapshot.Velocity = Enemy->GetVelocity();
+		Snapshot.CollisionRadius = Enemy->GetCapsuleComponent()->GetScaledCapsuleRadius();
+		Snapshot.NeighborRadius = Config->CrowdNeighborRadius;
+		Snapshot.Weight = Config->CrowdAvoidanceWeight;
+		Snapshot.TimeHorizon = Config->CrowdTimeHorizon;
+		Snapshot.MaxNeighbors = Config->CrowdMaxNeighbors;
+		Snapshot.MaxSpeed = Movement ? Movement->GetMaxSpeed() : 0.f;
+		Snapshot.GridHandle = SpatialGrid->GetHandle(Enemy);
+	}
+
+	// [2] 이웃 계산 (병렬)
+	AvoidanceResults.SetNumUninitialized(AgentSnapshots.Num());
+	const bool bSingleThread = AgentSnapshots.Num() < CVarXVCrowdParallelMinAgents.GetValueOnGameThread();
+	ParallelFor(AgentSnapshots.Num(), [this, SpatialGrid](int32 Index)
+	{
+		AvoidanceResults[Index] = ComputeAvoidance(*SpatialGrid, AgentSnapshots[Index]);
+	}, bSingleThread ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	// [3] 결과 적용
+	for (int32 Index = 0; Index < Agents.Num(); ++Index)
+	{
+		if (UXVEnemyMovementComponent* Movement = Cast<UXVEnemyMovementComponent>(Agents[Index]->GetCharacterMovement()))
+		{
+			Movement->SetCrowdAvoidanceVelocity(AvoidanceResults[Index]);
+		}
+	}
+}
+
+TStatId UXVCrowdAvoidanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UXVCrowdAvoidanceSubsystem, STATGROUP_Tickables);
+}
+
+bool UXVCrowdAvoidanceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UXVCrowdAvoidanceSubsystem::RegisterAgent(AXVEnemyBase* Enemy)
+{
+	if (!Enemy || !Enemy->GetAIConfigComponent()) return;
+
+	Agents.AddUnique(Enemy);
+}
+
+void UXVCrowdAvoidanceSubsystem::UnregisterAgent(AXVEnemyBase* Enemy)
+{
+	Agents.RemoveSwap(Enemy, EAllowShrinking::No);
+}
+
+void UXVCrowdAvoidanceSubsystem::GatherNeighborSnapshot(const UXVEnemySpatialGridSubsystem& SpatialGrid)
+{
+	// 회피 대상이 아닌 적도 이웃으로는 고려 (피해 가야 하므로)
+	const int32 MaxHandle = SpatialGrid.GetGrid().GetMaxHandle();
+	NeighborVelocities.SetNumZeroed(MaxHandle);
+	NeighborRadii.SetNumZeroed(MaxHandle);
+
+	for (int32 Handle = 0; Handle < MaxHandle; ++Handle)
+	{
+		if (const AXVEnemyBase* Enemy = SpatialGrid.GetEnemy(Handle))
+		{
+			NeighborVelocities[Handle] = Enemy->GetVelocity();
+			NeighborRadii[Handle] = Enemy->GetCapsuleComponent()->GetScaledCapsuleRadius();
+		}
+		else
+		{
+			NeighborVelocities[Handle] = FVector::ZeroVector;
+			NeighborRadii[Handle] = 0.f;
+		}
+	}
+}
+
+FVector UXVCrowdAvoidanceSubsystem::ComputeAvoidance(const UXVEnemySpatialGridSubsystem& SpatialGrid, const FXVCrowdAgentSnapshot& Agent) const
+{
+	if (Agent.MaxSpeed <= 0.f || Agent.MaxNeighbors <= 0) return FVector::ZeroVector;
+
+	FVector2D Push = FVector2D::ZeroVector;
+	int32 NumNeighbors = 0;
+
+	const FVector2D SelfLocation(Agent.Location);
+	const FVector2D SelfVelocity(Agent.Velocity);
+
+	SpatialGrid.GetGrid().ForEachInRadius(Agent.Location, Agent.NeighborRadius, [&](int32 Handle, const FVector& NeighborLocation)
+	{
+		if (Handle == Agent.GridHandle || NumNeighbors >= Agent.MaxNeighbors) return;
+		if (!NeighborRadii.IsValidIndex(Handle) || NeighborRadii[Handle] <= 0.f) return;
+
+		// 상대 위치/속도 기준 가장 가까워지는 시점의 거리 (Time Horizon 안에서)
+		const FVector2D RelativeLocation = FVector2D(NeighborLocation) - SelfLocation;
+		const FVector2D RelativeVelocity = SelfVelocity - FVector2D(NeighborVelocities[Handle]);
+		const float RelativeSpeedSq = RelativeVelocity.SizeSquared();
+		const float TimeToClosest = RelativeSpeedSq > UE_KINDA_SMALL_NUMBER
+			? FMath::Clamp(FVector2D::DotProduct(RelativeLocation, RelativeVelocity) / RelativeSpeedSq, 0.f, Agent.TimeHorizon)
+			: 0.f;
+
+		const FVector2D ClosestOffset = RelativeLocation - RelativeVelocity * TimeToClosest;
+		const float ClosestDistance = ClosestOffset.Size();
+		const float CombinedRadius = Agent.CollisionRadius + NeighborRadii[Handle];
+		if (ClosestDistance >= CombinedRadius) return;
+
+		// 겹칠수록, 빨리 부딪힐수록 강하게 밀어냄
+		const FVector2D AwayDirection = ClosestDistance > UE_KINDA_SMALL_NUMBER
+			? -ClosestOffset / ClosestDistance
+			: FVector2D(-RelativeLocation.Y, RelativeLocation.X).GetSafeNormal();
+		const float Penetration = (CombinedRadius - ClosestDistance) / CombinedRadius;
+		const float Urgency = Agent.TimeHorizon > 0.f ? 1.f - TimeToClosest / Agent.TimeHorizon : 1.f;
+
+		Push += AwayDirection * Penetration * (0.5f + 0.5f * Urgency);
+		++NumNeighbors;
+	});
+
+	if (NumNeighbors == 0) return FVector::ZeroVector;
+
+	const FVector2D Avoidance = Push.GetClampedToMaxSize(1.f) * Agent.MaxSpeed * Agent.Weight;
+	return FVector(Avoidance, 0.f);
+}
@@ -0,0 +1,138 @@
+﻿#include "AI/System/Perception/XVNoiseAggregatorSubsystem.h"
+#include "XV.h"
+#include "AI/Character/Base/XVEnemyBase.h"
+#include "AI/AIComponents/AIConfigComponent.h"
+#include "AI/System/Target/XVTargetSelectionSubsystem.h"
+#include "AI/System/Spatial/XVEnemySpatialGridSubsystem.h"
+#include "Perception/AISense_Hearing.h"
+#include "GameFramework/Pawn.h"
+
+static TAutoConsoleVariable<float> CVarXVNoiseWindow(
+	TEXT("XV.AI.NoiseWindow"),
+	0.25f,
+	TEXT("발신자별 청각 이벤트 최소 간격(초). 간격 안의 소음은 누적 후 한 번에 보고"));
+
+static TAutoConsoleVariable<float> CVarXVNoiseMaxLoudness(
+	TEXT("XV.AI.NoiseMaxLoudness"),
+	2.0f,
+	TEXT("누적된 소음 Loudness 상한"));
+
+void UXVNoiseAggregatorSubsystem::ReportNoise(AActor* Instigator, const FVector& Location, float Loudness, FName Tag, float Window)
+{
+	if (!Instigator) return;
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	FXVNoiseEmitterState& State = Emitters.FindOrAdd(Instigator);
+
+	State.Window = Window >= 0.f ? Window : CVarXVNoiseWindow.GetValueOnGameThread();
+	State.Location = Location;
+	State.Tag = Tag;
+	State.PendingLoudness = FMath::Min(State.PendingLoudness + Loudness, CVarXVNoiseMaxLoudness.GetValueOnGameThread());
+	State.bHasPending = true;
+
+	// 소음을 낸 플레이어일수록 AI 타겟으로 우선 선택됨
+	if (APawn* InstigatorPawn = Cast<APawn>(Instigator))
+	{
+		if (UXVTargetSelectionSubsystem* TargetSelection = GetWorld()->GetSubsystem<UXVTargetSelectionSubsystem>())
+		{
+			TargetSelection->AddThreat(InstigatorPawn, Loudness);
+		}
+	}
+
+	// 첫 발은 바로 보내서 반응 지연이 없도록 함
+	if (Now - State.LastEmitTime >= State.Window)
+	{
+		EmitNoise(Instigator, State, Now);
+	}
+}
+
+void UXVNoiseAggregatorSubsystem::RegisterHearingRange(float HearingRange)
+{
+	MaxHearingRange = FMath::Max(MaxHearingRange, HearingRange);
+}
+
+void UXVNoiseAggregatorSubsystem::Tick(float DeltaTime)
+{
+	XV_SCOPE_CYCLE_COUNTER(STAT_XV_AISubsystems);
+
+	FXVStressAITickScope StressScope;
+
+	Super::Tick(DeltaTime);
+
+	if (Emitters.IsEmpty()) return;
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	for (auto It = Emitters.CreateIterator(); It; ++It)
+	{
+		AActor* Instigator = It.Key().Get();
+		FXVNoiseEmitterState& State = It.Value();
+
+		if (!Instigator)
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		if (State.bHasPending && Now - State.LastEmitTime >= State.Window)
+		{
+			EmitNoise(Instigator, State, Now);
+		}
+		// 한동안 소음이 없던 발신자는 정리
+		else if (!State.bHasPending && Now - State.LastEmitTime > State.Window * 4.0)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+TStatId UXVNoiseAggregatorSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UXVNoiseAggregatorSubsystem, STATGROUP_Tickables);
+}
+
+bool UXVNoiseAggregatorSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UXVNoiseAggregatorSubsystem::EmitNoise(AActor* Instigator, FXVNoiseEmitterState& State, double Now)
+{
+	const float Loudness = State.PendingLoudness;
+	State.PendingLoudness = 0.f;
+	State.bHasPending = false;
+	State.LastEmitTime = Now;
+
+	if (!IsAnyListenerInRange(State.Location, Loudness)) return;
+
+	UAISense_Hearing::ReportNoiseEvent
+	(
+		GetWorld(),
+		State.Location,	// 소리 발생 위치
+		Loudness,		// 누적된 Loudness
+		Instigator,		// 소리 낸 Actor
+		0.f,			// 최대 범위 (0 = 리스너 설정 사용)
+		State.Tag		// 이벤트 식별 태그
+	);
+}
+
+bool UXVNoiseAggregatorSubsystem::IsAnyListenerInRange(const FVector& Location, float Loudness) const
+{
+	// 격자가 없으면 거르지 않고 엔진 청각 판정에 맡김
+	const UXVEnemySpatialGridSubsystem* SpatialGrid = GetWorld()->GetSubsystem<UXVEnemySpatialGridSubsystem>();
+	if (!SpatialGrid) return true;
+	if (SpatialGrid->GetNumEnemies() == 0) return false;
+
+	// 가장 넓은 청각 범위로 주변 적만 뽑고, 청각 판정과 같이 (HearingRange * Loudness) 안에 있는지 확인
+	bool bFound = false;
+	SpatialGrid->ForEachEnemyInRadius(Location, MaxHearingRange * Loudness, [&bFound, &Location, Loudness](AXVEnemyBase& Enemy, const FVector&)
+	{
+		if (bFound) return;
+
+		const UAIConfigComponent* Config = Enemy.GetAIConfigComponent();
+		if (!Config) return;
+
+		const float Range = Config->GetHearingRange() * Loudness;
+		bFound = FVector::DistSquared(Enemy.GetActorLocation(), Location) <= FMath::Square(Range);
+	});
+	return bFound;
+}
@@ -0,0 +1,100 @@
+﻿#include "AI/System/Perception/XVPerceptionRouterSubsystem.h"
+#include "Engine/GameInstance.h"
+#include "GameFramework/PlayerController.h"
+#include "System/XVGameMode.h"
+
+void UXVPerceptionRouterSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// 빙의 변경 시에만 플레이어 폰 갱신
+	if (UGameInstance* GI = InWorld.GetGameInstance())
+	{
+		GI->GetOnPawnControllerChanged().AddUniqueDynamic(this, &UXVPerceptionRouterSubsystem::OnPawnControllerChanged);
+	}
+
+	// 이미 빙의된 상태로 시작하는 경우
+	for (FConstPlayerControllerIterator It = InWorld.GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (PC && PC->GetPawn())
+		{
+			CachedPlayerPawns.AddUnique(PC->GetPawn());
+		}
+	}
+}
+
+bool UXVPerceptionRouterSubsystem::IsPlayerTarget(const AActor* Actor) const
+{
+	if (!Actor) return false;
+
+	for (const TWeakObjectPtr<APawn>& Pawn : CachedPlayerPawns)
+	{
+		if (Pawn.Get() == Actor) return true;
+	}
+	return false;
+}
+
+APawn* UXVPerceptionRouterSubsystem::GetPlayerPawn() const
+{
+	for (const TWeakObjectPtr<APawn>& Pawn : CachedPlayerPawns)
+	{
+		if (APawn* Resolved = Pawn.Get()) return Resolved;
+	}
+	return nullptr;
+}
+
+void UXVPerceptionRouterSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (UGameInstance* GI = World->GetGameInstance())
+		{
+			GI->GetOnPawnControllerChanged().RemoveAll(this);
+		}
+	}
+
+	Super::Deinitialize();
+}
+
+void UXVPerceptionRouterSubsystem::NotifyPlayerSpotted()
+{
+	// 이번 프레임에 이미 예약되어 있으면 무시
+	if (bPlayerSpottedPending) return;
+
+	bPlayerSpottedPending = true;
+	GetWorld()->GetTimerManager().SetTimerForNextTick(this, &UXVPerceptionRouterSubsystem::FlushPlayerSpotted);
+}
+
+bool UXVPerceptionRouterSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UXVPerceptionRouterSubsystem::OnPawnControllerChanged(APawn* Pawn, AController* Controller)
+{
+	// 파괴된 폰 정리
+	CachedPlayerPawns.RemoveAll([](const TWeakObjectPtr<APawn>& Cached) { return !Cached.IsValid(); });
+
+	if (!Pawn) return;
+
+	if (Controller && Controller->IsPlayerController())
+	{
+		CachedPlayerPawns.AddUnique(Pawn);
+	}
+	else
+	{
+		// 플레이어가 빙의를 해제한 경우
+		CachedPlayerPawns.Remove(Pawn);
+	}
+}
+
+void UXVPerceptionRouterSubsystem::FlushPlayerSpotted()
+{
+	bPlayerSpottedPending = false;
+
+	if (AXVGameMode* GameMode = GetWorld()->GetAuthGameMode<AXVGameMode>())
+	{
+		GameMode->OnWaveTriggered();
+	}
+}
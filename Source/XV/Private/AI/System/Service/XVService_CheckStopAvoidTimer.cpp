@@ -1,8 +1,11 @@
 ﻿#include "AI/System/Service/XVService_CheckStopAvoidTimer.h"
+#include "XV.h"
+#include "AI/DebugTool/XVBTProfiler.h"
 #include "BehaviorTree/BlackboardComponent.h"
 #include "AIController.h"
 #include "AI/AIComponents/AIConfigComponent.h"
 #include "GameFramework/Pawn.h"
+#include "AI/System/Target/XVTargetSelectionSubsystem.h"
 
 UXVService_CheckStopAvoidTimer::UXVService_CheckStopAvoidTimer()
 {
@@ -14,6 +17,10 @@ UXVService_CheckStopAvoidTimer::UXVService_CheckStopAvoidTimer()
 // 매 프레임(틱)마다 실행되며, AI가 특정 조건(회피 유지 시간) 이상일 때 행동 변화 플래그를 블랙보드에 기록
 void UXVService_CheckStopAvoidTimer::TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
 {
+	XV_SCOPE_CYCLE_COUNTER(STAT_XV_BTService);
+	XV_BT_PROFILE_SCOPE(OwnerComp);
+	FXVStressAITickScope StressScope;
+
 	Super::TickNode(OwnerComp, NodeMemory, DeltaSeconds);
 
 	// 블랙보드와 AIController, 그리고 자신의 Pawn을 안전하게 얻기 / 실패시 즉시 리턴
@@ -24,9 +31,14 @@ void UXVService_CheckStopAvoidTimer::TickNode(UBehaviorTreeComponent& OwnerComp,
 	APawn* MyPawn = AIController->GetPawn();
 	if (!MyPawn) return;
 
+	// 타겟 플레이어 (코옵: 가장 가깝거나 위협적인 플레이어, 없으면 중단)
+	const UXVTargetSelectionSubsystem* TargetSelection = GetWorld()->GetSubsystem<UXVTargetSelectionSubsystem>();
+	const APawn* TargetPawn = TargetSelection ? TargetSelection->SelectTargetFor(MyPawn) : nullptr;
+	if (!TargetPawn) return;
+
 	// AI 위치와 플레이어 위치 획득, 거리 계산
 	FVector AI_Location = MyPawn->GetActorLocation();
-	FVector Player_Location = GetWorld()->GetFirstPlayerController()->GetPawn()->GetActorLocation();
+	FVector Player_Location = TargetPawn->GetActorLocation();
 	float Distance = FVector::Dist(AI_Location, Player_Location);
 
 	// AI 공격 범위 체크
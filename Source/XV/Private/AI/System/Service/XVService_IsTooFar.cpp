@@ -1,6 +1,9 @@
 ﻿#include "AI/System/Service/XVService_IsTooFar.h"
+#include "XV.h"
+#include "AI/DebugTool/XVBTProfiler.h"
 #include "BehaviorTree/BlackboardComponent.h"
 #include "AIController.h"
+#include "AI/System/Target/XVTargetSelectionSubsystem.h"
 
 UXVService_IsTooFar::UXVService_IsTooFar()
 {
@@ -10,6 +13,10 @@ UXVService_IsTooFar::UXVService_IsTooFar()
 
 void UXVService_IsTooFar::TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
 {
+	XV_SCOPE_CYCLE_COUNTER(STAT_XV_BTService);
+	XV_BT_PROFILE_SCOPE(OwnerComp);
+	FXVStressAITickScope StressScope;
+
 	Super::TickNode(OwnerComp, NodeMemory, DeltaSeconds);
 
 	UBlackboardComponent* BB = OwnerComp.GetBlackboardComponent();
@@ -19,11 +26,9 @@ void UXVService_IsTooFar::TickNode(UBehaviorTreeComponent& OwnerComp, uint8* Nod
 	APawn* MyPawn = AIController->GetPawn();
 	if (!MyPawn) return;
 
-	// 플레이어 얻기 (싱글플레이 기준)
-	APlayerController* PlayerController = MyPawn->GetWorld()->GetFirstPlayerController();
-	if (!PlayerController) return;
-
-	APawn* PlayerPawn = PlayerController->GetPawn();
+	// 타겟 플레이어 얻기 (코옵: 가장 가깝거나 위협적인 플레이어)
+	const UXVTargetSelectionSubsystem* TargetSelection = MyPawn->GetWorld()->GetSubsystem<UXVTargetSelectionSubsystem>();
+	const APawn* PlayerPawn = TargetSelection ? TargetSelection->SelectTargetFor(MyPawn) : nullptr;
 	if (!PlayerPawn) return;
 
 	float Distance = FVector::Dist(MyPawn->GetActorLocation(), PlayerPawn->GetActorLocation());
@@ -0,0 +1,121 @@
+﻿#include "AI/System/Spatial/XVEnemySpatialGridSubsystem.h"
+#include "XV.h"
+#include "AI/Character/Base/XVEnemyBase.h"
+#include "Engine/World.h"
+
+static TAutoConsoleVariable<float> CVarXVEnemyGridCellSize(
+	TEXT("XV.AI.EnemyGridCellSize"),
+	500.f,
+	TEXT("적 공간 격자 셀 크기(cm). 월드 시작 시에만 적용"));
+
+void UXVEnemySpatialGridSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	Grid.Reset(CVarXVEnemyGridCellSize.GetValueOnGameThread());
+}
+
+void UXVEnemySpatialGridSubsystem::Deinitialize()
+{
+	Grid.Reset(Grid.GetCellSize());
+	EnemyByHandle.Empty();
+	HandleByEnemy.Empty();
+
+	Super::Deinitialize();
+}
+
+void UXVEnemySpatialGridSubsystem::Tick(float DeltaTime)
+{
+	XV_SCOPE_CYCLE_COUNTER(STAT_XV_AISubsystems);
+
+	FXVStressAITickScope StressScope;
+
+	Super::Tick(DeltaTime);
+
+	// 이동한 적만 격자 갱신 (셀이 같으면 위치만 덮어씀)
+	for (int32 Handle = 0; Handle < EnemyByHandle.Num(); ++Handle)
+	{
+		if (!Grid.IsValidHandle(Handle)) continue;
+
+		const AXVEnemyBase* Enemy = EnemyByHandle[Handle].Get();
+		if (!Enemy)
+		{
+			// EndPlay 없이 사라진 경우
+			Grid.Remove(Handle);
+			EnemyByHandle[Handle].Reset();
+			continue;
+		}
+
+		const FVector Location = Enemy->GetActorLocation();
+		if (!Location.Equals(Grid.GetLocation(Handle), 1.f))
+		{
+			Grid.Update(Handle, Location);
+		}
+	}
+}
+
+TStatId UXVEnemySpatialGridSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UXVEnemySpatialGridSubsystem, STATGROUP_Tickables);
+}
+
+bool UXVEnemySpatialGridSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UXVEnemySpatialGridSubsystem::RegisterEnemy(AXVEnemyBase* Enemy)
+{
+	if (!Enemy || HandleByEnemy.Contains(Enemy)) return;
+
+	const int32 Handle = Grid.Add(Enemy->GetActorLocation());
+	if (Handle >= EnemyByHandle.Num())
+	{
+		EnemyByHandle.SetNum(Handle + 1);
+	}
+	EnemyByHandle[Handle] = Enemy;
+	HandleByEnemy.Add(Enemy, Handle);
+}
+
+void UXVEnemySpatialGridSubsystem::UnregisterEnemy(AXVEnemyBase* Enemy)
+{
+	int32 Handle = INDEX_NONE;
+	if (!Enemy || !HandleByEnemy.RemoveAndCopyValue(Enemy, Handle)) return;
+
+	Grid.Remove(Handle);
+	EnemyByHandle[Handle].Reset();
+}
+
+int32 UXVEnemySpatialGridSubsystem::GetHandle(const AXVEnemyBase* Enemy) const
+{
+	const int32* Handle = HandleByEnemy.Find(Enemy);
+	return Handle ? *Handle : INDEX_NONE;
+}
+
+int32 UXVEnemySpatialGridSubsystem::QueryRadius(const FVector& Center, float Radius, TArray<AXVEnemyBase*>& OutEnemies, const AXVEnemyBase* IgnoreEnemy) const
+{
+	OutEnemies.Reset();
+	ForEachEnemyInRadius(Center, Radius, [&OutEnemies, IgnoreEnemy](AXVEnemyBase& Enemy, const FVector&)
+	{
+		if (&Enemy != IgnoreEnemy)
+		{
+			OutEnemies.Add(&Enemy);
+		}
+	});
+	return OutEnemies.Num();
+}
+
+int32 UXVEnemySpatialGridSubsystem::QueryBox(const FBox& Box, TArray<AXVEnemyBase*>& OutEnemies, TArray<int32>& HandleBuffer) const
+{
+	OutEnemies.Reset();
+
+	Grid.QueryBox(Box, HandleBuffer);
+	for (const int32 Handle : HandleBuffer)
+	{
+		if (AXVEnemyBase* Enemy = EnemyByHandle[Handle].Get())
+		{
+			OutEnemies.Add(Enemy);
+		}
+	}
+	return OutEnemies.Num();
+}
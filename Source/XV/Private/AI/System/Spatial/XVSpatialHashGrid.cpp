@@ -0,0 +1,114 @@
+﻿#include "AI/System/Spatial/XVSpatialHashGrid.h"
+
+FXVSpatialHashGrid::FXVSpatialHashGrid(float InCellSize)
+{
+	Reset(InCellSize);
+}
+
+void FXVSpatialHashGrid::Reset(float InCellSize)
+{
+	CellSize = FMath::Max(InCellSize, 1.f);
+	InvCellSize = 1.f / CellSize;
+
+	Entries.Empty();
+	Cells.Empty();
+}
+
+int32 FXVSpatialHashGrid::Add(const FVector& Location)
+{
+	FEntry NewEntry;
+	NewEntry.Location = Location;
+	NewEntry.Cell = ToCell(Location);
+
+	const int32 Handle = Entries.Add(NewEntry);
+	AddToCell(Handle, NewEntry.Cell);
+	return Handle;
+}
+
+void FXVSpatialHashGrid::Remove(int32 Handle)
+{
+	if (!Entries.IsValidIndex(Handle)) return;
+
+	RemoveFromCell(Handle);
+	Entries.RemoveAt(Handle);
+}
+
+void FXVSpatialHashGrid::Update(int32 Handle, const FVector& Location)
+{
+	if (!Entries.IsValidIndex(Handle)) return;
+
+	FEntry& Entry = Entries[Handle];
+	Entry.Location = Location;
+
+	// 셀이 그대로면 위치만 갱신
+	const FIntPoint NewCell = ToCell(Location);
+	if (NewCell == Entry.Cell) return;
+
+	RemoveFromCell(Handle);
+	Entry.Cell = NewCell;
+	AddToCell(Handle, NewCell);
+}
+
+int32 FXVSpatialHashGrid::QueryRadius(const FVector& Center, float Radius, TArray<int32>& OutHandles) const
+{
+	OutHandles.Reset();
+	ForEachInRadius(Center, Radius, [&OutHandles](int32 Handle, const FVector&)
+	{
+		OutHandles.Add(Handle);
+	});
+	return OutHandles.Num();
+}
+
+int32 FXVSpatialHashGrid::QueryBox(const FBox& Box, TArray<int32>& OutHandles) const
+{
+	OutHandles.Reset();
+	if (Entries.Num() == 0 || !Box.IsValid) return 0;
+
+	const FIntPoint MinCell = ToCell(Box.Min);
+	const FIntPoint MaxCell = ToCell(Box.Max);
+
+	for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+	{
+		for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+		{
+			const TArray<int32>* CellHandles = Cells.Find(FIntPoint(CellX, CellY));
+			if (!CellHandles) continue;
+
+			for (const int32 Handle : *CellHandles)
+			{
+				if (Box.IsInsideOrOn(Entries[Handle].Location))
+				{
+					OutHandles.Add(Handle);
+				}
+			}
+		}
+	}
+	return OutHandles.Num();
+}
+
+void FXVSpatialHashGrid::AddToCell(int32 Handle, const FIntPoint& Cell)
+{
+	TArray<int32>& CellHandles = Cells.FindOrAdd(Cell);
+	Entries[Handle].SlotInCell = CellHandles.Add(Handle);
+}
+
+void FXVSpatialHashGrid::RemoveFromCell(int32 Handle)
+{
+	FEntry& Entry = Entries[Handle];
+	TArray<int32>* CellHandles = Cells.Find(Entry.Cell);
+	if (!CellHandles || !CellHandles->IsValidIndex(Entry.SlotInCell)) return;
+
+	// 마지막 항목을 빈 자리로 옮기고 그 항목의 슬롯 번호 갱신
+	const int32 Slot = Entry.SlotInCell;
+	CellHandles->RemoveAtSwap(Slot, EAllowShrinking::No);
+	if (CellHandles->IsValidIndex(Slot))
+	{
+		Entries[(*CellHandles)[Slot]].SlotInCell = Slot;
+	}
+	Entry.SlotInCell = INDEX_NONE;
+
+	if (CellHandles->IsEmpty())
+	{
+		Cells.Remove(Entry.Cell);
+	}
+}
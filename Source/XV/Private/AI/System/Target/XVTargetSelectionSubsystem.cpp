@@ -0,0 +1,198 @@
+﻿#include "AI/System/Target/XVTargetSelectionSubsystem.h"
+#include "XV.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Algo/LowerBound.h"
+
+static TAutoConsoleVariable<float> CVarXVThreatDistanceScale(
+	TEXT("XV.AI.ThreatDistanceScale"),
+	500.f,
+	TEXT("위협도 1당 타겟 선택 시 가깝게 취급할 거리(cm)"));
+
+static TAutoConsoleVariable<float> CVarXVThreatDecay(
+	TEXT("XV.AI.ThreatDecay"),
+	1.f,
+	TEXT("초당 위협도 감소량"));
+
+static TAutoConsoleVariable<float> CVarXVThreatMax(
+	TEXT("XV.AI.ThreatMax"),
+	5.f,
+	TEXT("플레이어별 위협도 상한"));
+
+void UXVTargetSelectionSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// 첫 틱 전에 실행되는 BT 노드도 타겟을 받을 수 있도록
+	RebuildIndex();
+}
+
+void UXVTargetSelectionSubsystem::Tick(float DeltaTime)
+{
+	XV_SCOPE_CYCLE_COUNTER(STAT_XV_AISubsystems);
+
+	FXVStressAITickScope StressScope;
+
+	Super::Tick(DeltaTime);
+
+	// 위협도 감소
+	const float Decay = CVarXVThreatDecay.GetValueOnGameThread() * DeltaTime;
+	for (auto It = ThreatByPawn.CreateIterator(); It; ++It)
+	{
+		It.Value() -= Decay;
+		if (It.Value() <= 0.f || !It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	RebuildIndex();
+}
+
+TStatId UXVTargetSelectionSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UXVTargetSelectionSubsystem, STATGROUP_Tickables);
+}
+
+bool UXVTargetSelectionSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+APawn* UXVTargetSelectionSubsystem::FindNearestTarget(const FVector& From, float MaxDistance) const
+{
+	const int32 Num = Entries.Num();
+	if (Num == 0) return nullptr;
+
+	float BestDistSq = FMath::Square(MaxDistance);
+	APawn* BestPawn = nullptr;
+
+	// From.X 위치에서 양쪽으로 넓혀가며, X 차이만으로도 더 멀면 중단
+	const int32 Pivot = LowerBoundByX(From.X);
+	for (int32 Right = Pivot; Right < Num; ++Right)
+	{
+		const FXVPlayerTargetEntry& Entry = Entries[Right];
+		if (FMath::Square(Entry.Location.X - From.X) >= BestDistSq) break;
+
+		const float DistSq = FVector::DistSquared(Entry.Location, From);
+		if (DistSq < BestDistSq)
+		{
+			if (APawn* Pawn = Entry.Pawn.Get())
+			{
+				BestDistSq = DistSq;
+				BestPawn = Pawn;
+			}
+		}
+	}
+	for (int32 Left = Pivot - 1; Left >= 0; --Left)
+	{
+		const FXVPlayerTargetEntry& Entry = Entries[Left];
+		if (FMath::Square(From.X - Entry.Location.X) >= BestDistSq) break;
+
+		const float DistSq = FVector::DistSquared(Entry.Location, From);
+		if (DistSq < BestDistSq)
+		{
+			if (APawn* Pawn = Entry.Pawn.Get())
+			{
+				BestDistSq = DistSq;
+				BestPawn = Pawn;
+			}
+		}
+	}
+
+	return BestPawn;
+}
+
+APawn* UXVTargetSelectionSubsystem::SelectTarget(const FVector& From) const
+{
+	// 위협도가 없으면 가장 가까운 플레이어와 같음
+	const float ThreatScale = CVarXVThreatDistanceScale.GetValueOnGameThread();
+	if (MaxThreat <= 0.f || ThreatScale <= 0.f)
+	{
+		return FindNearestTarget(From);
+	}
+
+	const int32 Num = Entries.Num();
+	if (Num == 0) return nullptr;
+
+	// X 차이 - 최대 보너스가 현재 최고 점수보다 크면 그 너머는 볼 필요 없음
+	const float MaxBonus = MaxThreat * ThreatScale;
+	float BestScore = TNumericLimits<float>::Max();
+	APawn* BestPawn = nullptr;
+
+	auto Evaluate = [&](const FXVPlayerTargetEntry& Entry)
+	{
+		const float Score = FVector::Dist(Entry.Location, From) - Entry.Threat * ThreatScale;
+		if (Score < BestScore)
+		{
+			if (APawn* Pawn = Entry.Pawn.Get())
+			{
+				BestScore = Score;
+				BestPawn = Pawn;
+			}
+		}
+	};
+
+	const int32 Pivot = LowerBoundByX(From.X);
+	for (int32 Right = Pivot; Right < Num; ++Right)
+	{
+		if (Entries[Right].Location.X - From.X - MaxBonus >= BestScore) break;
+		Evaluate(Entries[Right]);
+	}
+	for (int32 Left = Pivot - 1; Left >= 0; --Left)
+	{
+		if (From.X - Entries[Left].Location.X - MaxBonus >= BestScore) break;
+		Evaluate(Entries[Left]);
+	}
+
+	return BestPawn;
+}
+
+APawn* UXVTargetSelectionSubsystem::SelectTargetFor(const APawn* Seeker) const
+{
+	return Seeker ? SelectTarget(Seeker->GetActorLocation()) : nullptr;
+}
+
+void UXVTargetSelectionSubsystem::AddThreat(APawn* Player, float Amount)
+{
+	if (!Player || Amount <= 0.f) return;
+
+	float& Threat = ThreatByPawn.FindOrAdd(Player);
+	Threat = FMath::Min(Threat + Amount, CVarXVThreatMax.GetValueOnGameThread());
+}
+
+void UXVTargetSelectionSubsystem::RebuildIndex()
+{
+	// 같은 프레임에 두 번 만들지 않음
+	if (LastBuildFrame == GFrameCounter) return;
+	LastBuildFrame = GFrameCounter;
+
+	Entries.Reset();
+	MaxThreat = 0.f;
+
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		APawn* Pawn = PC ? PC->GetPawn() : nullptr;
+		if (!IsValid(Pawn)) continue;
+
+		FXVPlayerTargetEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.Pawn = Pawn;
+		Entry.Location = Pawn->GetActorLocation();
+		if (const float* Threat = ThreatByPawn.Find(Pawn))
+		{
+			Entry.Threat = *Threat;
+			MaxThreat = FMath::Max(MaxThreat, *Threat);
+		}
+	}
+
+	Entries.Sort([](const FXVPlayerTargetEntry& A, const FXVPlayerTargetEntry& B)
+	{
+		return A.Location.X < B.Location.X;
+	});
+}
+
+int32 UXVTargetSelectionSubsystem::LowerBoundByX(float X) const
+{
+	return Algo::LowerBoundBy(Entries, X, [](const FXVPlayerTargetEntry& Entry) { return Entry.Location.X; });
+}
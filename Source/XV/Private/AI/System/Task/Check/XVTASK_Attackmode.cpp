@@ -1,10 +1,13 @@
 ﻿#include "XVTASK_Attackmode.h"
+#include "XV.h"
+#include "AI/DebugTool/XVBTProfiler.h"
 
 // 추가됨
 #include "AIController.h"
 #include "AI/AIComponents/AIConfigComponent.h"
 #include "BehaviorTree/BlackboardComponent.h"
 #include "Navigation/PathFollowingComponent.h"
+#include "AI/System/Target/XVTargetSelectionSubsystem.h"
 
 UXVTASK_Attackmode::UXVTASK_Attackmode()
 {
@@ -15,6 +18,10 @@ UXVTASK_Attackmode::UXVTASK_Attackmode()
 
 EBTNodeResult::Type UXVTASK_Attackmode::ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
 {
+	XV_SCOPE_CYCLE_COUNTER(STAT_XV_BTTask);
+	XV_BT_PROFILE_SCOPE(OwnerComp);
+	FXVStressAITickScope StressScope;
+
 	// 오너 확인
 	AAIController* AIController = OwnerComp.GetAIOwner();
 	if (!AIController) return EBTNodeResult::Failed;
@@ -49,8 +56,12 @@ EBTNodeResult::Type UXVTASK_Attackmode::ExecuteTask(UBehaviorTreeComponent& Owne
 	
 	else if (Distance > Attackrange)
 	{
-		// 벡터 값 가져오기
-		FVector TargetVector = GetWorld()->GetFirstPlayerController()->GetPawn()->GetActorLocation();
+		// 타겟 플레이어 위치 (코옵: 가장 가깝거나 위협적인 플레이어)
+		const UXVTargetSelectionSubsystem* TargetSelection = GetWorld()->GetSubsystem<UXVTargetSelectionSubsystem>();
+		const APawn* TargetPawn = TargetSelection ? TargetSelection->SelectTargetFor(MyPawn) : nullptr;
+		if (!TargetPawn) return EBTNodeResult::Failed;
+
+		FVector TargetVector = TargetPawn->GetActorLocation();
 	
 		// 이동 요청 생성
 		FAIMoveRequest MoveRequest;
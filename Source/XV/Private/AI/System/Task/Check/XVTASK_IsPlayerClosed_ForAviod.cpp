@@ -1,11 +1,18 @@
 ﻿#include "XVTASK_IsPlayerClosed_ForAviod.h"
+#include "XV.h"
+#include "AI/DebugTool/XVBTProfiler.h"
 #include "AIController.h"
 #include "AI/AIComponents/AIConfigComponent.h"
 #include "BehaviorTree/BlackboardComponent.h"
 #include "NavigationSystem.h"
+#include "AI/System/Target/XVTargetSelectionSubsystem.h"
 
 EBTNodeResult::Type UXVTASK_IsPlayerClosed_ForAviod::ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
 {
+    XV_SCOPE_CYCLE_COUNTER(STAT_XV_BTTask);
+    XV_BT_PROFILE_SCOPE(OwnerComp);
+    FXVStressAITickScope StressScope;
+
     // AI 컨트롤러, 소유 폰 체크
     AAIController* AIController = OwnerComp.GetAIOwner();
     if (!AIController) return EBTNodeResult::Failed;
@@ -24,9 +31,14 @@ EBTNodeResult::Type UXVTASK_IsPlayerClosed_ForAviod::ExecuteTask(UBehaviorTreeCo
     UWorld* World = MyPawn->GetWorld();
     if (!World) return EBTNodeResult::Failed;
     
+    // 타겟 플레이어 (코옵: 가장 가깝거나 위협적인 플레이어, 없으면 중단)
+    const UXVTargetSelectionSubsystem* TargetSelection = World->GetSubsystem<UXVTargetSelectionSubsystem>();
+    const APawn* TargetPawn = TargetSelection ? TargetSelection->SelectTargetFor(MyPawn) : nullptr;
+    if (!TargetPawn) return EBTNodeResult::Failed;
+
     // 거리 계산
     const FVector AI_Location = MyPawn->GetActorLocation();
-    const FVector Player_Location = GetWorld()->GetFirstPlayerController()->GetPawn()->GetActorLocation();
+    const FVector Player_Location = TargetPawn->GetActorLocation();
     const float Distance = FVector::Dist(AI_Location, Player_Location);
 
     // AI 공격 범위 체크
@@ -48,6 +60,7 @@ EBTNodeResult::Type UXVTASK_IsPlayerClosed_ForAviod::ExecuteTask(UBehaviorTreeCo
     FNavLocation NavResult;
     UNavigationSystemV1* NavSys = UNavigationSystemV1::GetCurrent(World);
     
+    XV_COUNT_NAV_REQUEST();
     if (NavSys && NavSys->ProjectPointToNavigation(TargetLocation, NavResult))
     {
         BlackboardComp->SetValueAsVector(TEXT("AvoidLocation"),NavResult.Location);
@@ -1,4 +1,6 @@
 ﻿#include "AI/System/Task/Move/XVTASK_ChasingLocation.h"
+#include "XV.h"
+#include "AI/DebugTool/XVBTProfiler.h"
 
 // 추가됨
 #include "BehaviorTree/BehaviorTreeComponent.h"
@@ -6,6 +8,7 @@
 #include "NavigationSystem.h"
 #include "AIController.h"
 #include "Navigation/PathFollowingComponent.h"
+#include "AI/System/Target/XVTargetSelectionSubsystem.h"
 
 UXVTASK_ChasingLocation::UXVTASK_ChasingLocation()
 {
@@ -21,6 +24,10 @@ EBTNodeResult::Type UXVTASK_ChasingLocation::ExecuteTask(UBehaviorTreeComponent&
 
 void UXVTASK_ChasingLocation::TickTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
 {
+	XV_SCOPE_CYCLE_COUNTER(STAT_XV_BTTask);
+	XV_BT_PROFILE_SCOPE(OwnerComp);
+	FXVStressAITickScope StressScope;
+
 	Super::TickTask(OwnerComp, NodeMemory, DeltaSeconds);
 	
 	// 오너 확인
@@ -38,8 +45,12 @@ void UXVTASK_ChasingLocation::TickTask(UBehaviorTreeComponent& OwnerComp, uint8*
 	// 블랙보드 컴포넌트 가져오기
 	UBlackboardComponent* BlackboardComp = OwnerComp.GetBlackboardComponent();
 
-	// 벡터 값 가져오기
-	FVector TargetVector = GetWorld()->GetFirstPlayerController()->GetPawn()->GetActorLocation();
+	// 타겟 플레이어 위치 (코옵: 가장 가깝거나 위협적인 플레이어)
+	const UXVTargetSelectionSubsystem* TargetSelection = GetWorld()->GetSubsystem<UXVTargetSelectionSubsystem>();
+	const APawn* TargetPawn = TargetSelection ? TargetSelection->SelectTargetFor(MyPawn) : nullptr;
+	if (!TargetPawn) return;
+
+	FVector TargetVector = TargetPawn->GetActorLocation();
 	
 	// 이동 요청 생성
 	FAIMoveRequest MoveRequest;
@@ -1,4 +1,6 @@
 ﻿#include "AI/System/Task/Move/XVTASK_FindRandomLocation.h"
+#include "XV.h"
+#include "AI/DebugTool/XVBTProfiler.h"
 
 // 추가됨
 #include "BehaviorTree/BehaviorTreeComponent.h"
@@ -6,6 +8,7 @@
 #include "NavigationSystem.h"
 #include "AIController.h"
 #include "AI/DebugTool/DebugTool.h"
+#include "System/XVRandomStreamSubsystem.h"
 
 UXVTASK_FindRandomLocation::UXVTASK_FindRandomLocation()
 {
@@ -15,6 +18,10 @@ UXVTASK_FindRandomLocation::UXVTASK_FindRandomLocation()
 
 EBTNodeResult::Type UXVTASK_FindRandomLocation::ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
 {
+	XV_SCOPE_CYCLE_COUNTER(STAT_XV_BTTask);
+	XV_BT_PROFILE_SCOPE(OwnerComp);
+	FXVStressAITickScope StressScope;
+
 	// 오너 확인
 	AAIController* AIController = OwnerComp.GetAIOwner();
 	if (!AIController) return EBTNodeResult::Failed;
@@ -34,19 +41,21 @@ EBTNodeResult::Type UXVTASK_FindRandomLocation::ExecuteTask(UBehaviorTreeCompone
 		return EBTNodeResult::Failed;
 	}
 
-	FNavLocation RandomLocation;
-	bool bFound = NavSystem->GetRandomReachablePointInRadius(MyPawn->GetActorLocation(), SearchRadius, RandomLocation);
+	// 시드 고정 스트림 사용 (같은 -XVSeed 면 같은 위치)
+	FVector RandomLocation;
+	XV_COUNT_NAV_REQUEST();
+	bool bFound = UXVRandomStreamSubsystem::GetRandomNavPointInRadius(MyPawn, UXVRandomStreamSubsystem::NavigationDomain, MyPawn->GetActorLocation(), SearchRadius, RandomLocation);
 
 	if (bFound)
 	{
 		UBlackboardComponent* BlackboardComp = OwnerComp.GetBlackboardComponent();
 		if (BlackboardComp)
 		{
-			BlackboardComp->SetValueAsVector(LocationKey.SelectedKeyName, RandomLocation.Location);
+			BlackboardComp->SetValueAsVector(LocationKey.SelectedKeyName, RandomLocation);
 			return EBTNodeResult::Succeeded;  
 		}
 	}
 
-	UE_LOG(Log_XV_AI, Warning, TEXT("Find Random Location Failed")); 
+	XV_LOG_THROTTLED(Log_XV_AI, Log, TEXT("Find Random Location Failed"));
 	return EBTNodeResult::Failed;  // 실패
 }
@@ -1,8 +1,11 @@
 #include "AI/System/Task/Ranged/XVTask_FindSnippingLocation.h"
+#include "XV.h"
+#include "AI/DebugTool/XVBTProfiler.h"
 #include "AI/DebugTool/DebugTool.h"
 #include "AIController.h"
 #include "BehaviorTree/BlackboardComponent.h"
 #include "NavigationSystem.h"
+#include "System/XVRandomStreamSubsystem.h"
 
 UXVTask_FindSnippingLocation::UXVTask_FindSnippingLocation()
 {
@@ -13,74 +16,67 @@ UXVTask_FindSnippingLocation::UXVTask_FindSnippingLocation()
 
 EBTNodeResult::Type UXVTask_FindSnippingLocation::ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
 {
-	UE_LOG(Log_XV_AI, Warning, TEXT("Find Snipping Location1"));
-	
+	XV_SCOPE_CYCLE_COUNTER(STAT_XV_BTTask);
+	XV_BT_PROFILE_SCOPE(OwnerComp);
+	FXVStressAITickScope StressScope;
+
 	AAIController* AIController = OwnerComp.GetAIOwner();
 	if (!AIController) return EBTNodeResult::Failed;
 
-	UE_LOG(Log_XV_AI, Warning, TEXT("Find Snipping Location2"));
-	
 	APawn* MyPawn = AIController->GetPawn();
 	if (!MyPawn) return EBTNodeResult::Failed;
 
-	UE_LOG(Log_XV_AI, Warning, TEXT("Find Snipping Location3"));
-	
 	UBlackboardComponent* Blackboard = OwnerComp.GetBlackboardComponent();
 	if (!Blackboard) return EBTNodeResult::Failed;
 
-	UE_LOG(Log_XV_AI, Warning, TEXT("Find Snipping Location4"));
-	
 	AActor* Target = Cast<AActor>(Blackboard->GetValueAsObject(TargetKey.SelectedKeyName));
 	if (!Target) return EBTNodeResult::Failed;
 
-	UE_LOG(Log_XV_AI, Warning, TEXT("Find Snipping Location5"));
-
 	UNavigationSystemV1* NavSys = UNavigationSystemV1::GetCurrent(GetWorld());
+	if (!NavSys) return EBTNodeResult::Failed;
 
 	FVector TargetLocation = Target->GetActorLocation();
+
+	// 실패 사유는 반복마다 찍지 않고 마지막에 한 줄로 요약
+	int32 NavFailCount = 0;
+	int32 RangeFailCount = 0;
+	int32 BlockedCount = 0;
 	
 	for (int i = 0; i < 20; ++i)
 	{
-		UE_LOG(Log_XV_AI, Warning, TEXT("Find Snipping Location : for Loop Start"));
-		
 		FVector RandomPoint;
-		if (NavSys->K2_GetRandomReachablePointInRadius(this, TargetLocation, RandomPoint, SearchRadius))
+		XV_COUNT_NAV_REQUEST();
+		if (!UXVRandomStreamSubsystem::GetRandomNavPointInRadius(MyPawn, UXVRandomStreamSubsystem::NavigationDomain, TargetLocation, SearchRadius, RandomPoint, 1))
 		{
-			UE_LOG(Log_XV_AI, Warning, TEXT("K2_GetRandomReachablePointInRadius"));
-			
-			float Distance = FVector::Dist(RandomPoint, TargetLocation);
-			if (Distance >= MinRange && Distance <= MaxRange)
-			{
-				UE_LOG(Log_XV_AI, Warning, TEXT("Distance Succeed"));
-				
-				FHitResult Hit;
-				bool bVisible = !GetWorld()->LineTraceSingleByChannel(
-					Hit,
-					RandomPoint,
-					TargetLocation,
-					ECC_Visibility);
-				if (bVisible)
-				{
-					Blackboard->SetValueAsVector(SnippingLocationKey.SelectedKeyName, RandomPoint);
-					UE_LOG(Log_XV_AI, Warning, TEXT("Find Snipping Location Succeeded"));
-					return EBTNodeResult::Succeeded;
-				}
-				else
-				{
-					UE_LOG(Log_XV_AI, Warning, TEXT("Line Trace Single By Channel Fail"));
-				}
-			}
-			else
-			{
-				UE_LOG(Log_XV_AI, Warning, TEXT("Distance fail"));
-			}
+			NavFailCount++;
+			continue;
 		}
-		else
+
+		float Distance = FVector::Dist(RandomPoint, TargetLocation);
+		if (Distance < MinRange || Distance > MaxRange)
+		{
+			RangeFailCount++;
+			continue;
+		}
+
+		FHitResult Hit;
+		XV_COUNT_TRACE();
+		bool bVisible = !GetWorld()->LineTraceSingleByChannel(
+			Hit,
+			RandomPoint,
+			TargetLocation,
+			ECC_Visibility);
+		if (!bVisible)
 		{
-			UE_LOG(Log_XV_AI, Warning, TEXT("K2_GetRandomReachablePointInRadius Fail"));
+			BlockedCount++;
+			continue;
 		}
+
+		Blackboard->SetValueAsVector(SnippingLocationKey.SelectedKeyName, RandomPoint);
+		XV_LOG_THROTTLED(Log_XV_AI, Verbose, TEXT("Find Snipping Location Succeeded (%s, try %d)"), *MyPawn->GetName(), i + 1);
+		return EBTNodeResult::Succeeded;
 	}
 
-	UE_LOG(Log_XV_AI, Warning, TEXT("Find Snipping Location Failed"));
+	XV_LOG_THROTTLED(Log_XV_AI, Log, TEXT("Find Snipping Location Failed (%s) NavFail=%d RangeFail=%d Blocked=%d"), *MyPawn->GetName(), NavFailCount, RangeFailCount, BlockedCount);
 	return EBTNodeResult::Failed;
-}
\ No newline at end of file
+}
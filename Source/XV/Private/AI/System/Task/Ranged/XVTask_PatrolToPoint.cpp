@@ -1,4 +1,6 @@
 #include "AI/System/Task/Ranged/XVTask_PatrolToPoint.h"
+#include "XV.h"
+#include "AI/DebugTool/XVBTProfiler.h"
 #include "AI/Character/Base/XVEnemyBase.h"
 #include "BehaviorTree/BlackboardComponent.h"
 #include "AIController.h"
@@ -11,6 +13,10 @@ UXVTask_PatrolToPoint::UXVTask_PatrolToPoint()
 
 EBTNodeResult::Type UXVTask_PatrolToPoint::ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
 {
+	XV_SCOPE_CYCLE_COUNTER(STAT_XV_BTTask);
+	XV_BT_PROFILE_SCOPE(OwnerComp);
+	FXVStressAITickScope StressScope;
+
 	AAIController* AIController = OwnerComp.GetAIOwner();
 	if (!AIController) return EBTNodeResult::Failed;
 
@@ -20,11 +26,10 @@ EBTNodeResult::Type UXVTask_PatrolToPoint::ExecuteTask(UBehaviorTreeComponent& O
 	int32 Index = MyCharacter->CurrentPatrolIndex;
 
 	AActor* NextPoint = MyCharacter->PatrolPoints[Index];
-
-	UE_LOG(Log_XV_AI, Warning, TEXT("Set Next Patrol Point %s"), *NextPoint->GetName());
-	
 	if (!NextPoint) return EBTNodeResult::Failed;
 
+	XV_LOG_THROTTLED(Log_XV_AI, Verbose, TEXT("Set Next Patrol Point %s"), *NextPoint->GetName());
+
 	UBlackboardComponent* Blackboard = OwnerComp.GetBlackboardComponent();
 	if (!Blackboard) return EBTNodeResult::Failed;
 
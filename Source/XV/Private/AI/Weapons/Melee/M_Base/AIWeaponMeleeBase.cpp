@@ -1,10 +1,10 @@
 ﻿#include "AI/Weapons/Melee/M_Base/AIWeaponMeleeBase.h"
+#include "XV.h"
 
 #include "AI/Character/Base/XVEnemyBase.h"
 #include "Components/AudioComponent.h"
 #include "Components/BoxComponent.h"
 #include "Character/XVCharacter.h"
-#include "Kismet/KismetSystemLibrary.h"
 #include "AI/AIComponents/AIStatusComponent.h"
 
 AAIWeaponMeleeBase::AAIWeaponMeleeBase()
@@ -16,69 +16,110 @@ AAIWeaponMeleeBase::AAIWeaponMeleeBase()
     NoHitSound->bAutoActivate = false;
 }
 
+void AAIWeaponMeleeBase::BeginPlay()
+{
+    Super::BeginPlay();
+
+    // 대상 ObjectType(여기서는 Pawn만), 자기 자신과 들고 있는 적은 판정에서 제외
+    static const FName MeleeTraceTag(TEXT("XVMeleeSweep"));
+    MeleeQueryParams = FCollisionQueryParams(MeleeTraceTag, false, this);
+    if (GetOwner())
+    {
+        MeleeQueryParams.AddIgnoredActor(GetOwner());
+    }
+    MeleeObjectParams = FCollisionObjectQueryParams(ECC_Pawn);
+    MeleeSweepHits.Reserve(8);
+}
+
+// === 근접 판정 구간 ===
+void AAIWeaponMeleeBase::BeginMeleeWindow()
+{
+    MeleeHitActors.Reset();
+    LastMeleeTransform = BoxComponent->GetComponentTransform();
+    bMeleeWindowActive = true;
+
+    // 시작 프레임은 제자리 판정
+    SweepMeleeVolume();
+}
+
+void AAIWeaponMeleeBase::TickMeleeWindow()
+{
+    if (!bMeleeWindowActive) return;
+
+    SweepMeleeVolume();
+}
+
+void AAIWeaponMeleeBase::EndMeleeWindow(bool bInterrupted)
+{
+    if (!bMeleeWindowActive) return;
+
+    bMeleeWindowActive = false;
+
+    // 피격/사망 등으로 몽타주가 끊긴 경우 남은 구간은 판정하지 않음
+    if (bInterrupted) return;
+
+    SweepMeleeVolume();
+
+    // 아무 타격이 없으면 미스 사운드 재생
+    if (MeleeHitActors.IsEmpty() && NoHitSound)
+    {
+        NoHitSound->Play();
+    }
+}
+
 // 근접 판정 (애니메이션 등에서 직접 호출)
 void AAIWeaponMeleeBase::CheckMeleeHit()
 {
-    // 트레이스 시작/종료 위치(정지 상태라면 동일)
-    FVector Start = BoxComponent->GetComponentLocation();
-    FVector End = Start;
-
-    // 판정 구체 반경 (공격에 따라 적절히 수정)
-    float Radius = 80.f;
-
-    // 대상 ObjectType(여기서는 Pawn만)
-    TArray<TEnumAsByte<EObjectTypeQuery>> ObjectTypes;
-    ObjectTypes.Add(UEngineTypes::ConvertToObjectType(ECollisionChannel::ECC_Pawn));
-
-    // 자기 자신은 판정에서 제외
-    TArray<AActor*> IgnoreActors;
-    IgnoreActors.Add(this);
-
-    // 결과값 저장용 배열
-    TArray<FHitResult> OutHits;
-
-    // 구체(스피어) 트레이스 - 여러 명 동시 판정
-    UKismetSystemLibrary::SphereTraceMultiForObjects(
-        GetWorld(),
-        Start, End,
-        Radius,
-        ObjectTypes,
-        false,
-        IgnoreActors,
-        EDrawDebugTrace::None,
-        OutHits,
-        true
-    );
-
-    // 플레이어 피격 여부 체크
-    bool bPlayerHit = false;
-    
-    for (const FHitResult& Hit : OutHits)
+    BeginMeleeWindow();
+    EndMeleeWindow();
+}
+
+void AAIWeaponMeleeBase::SweepMeleeVolume()
+{
+    XV_SCOPE_CYCLE_COUNTER(STAT_XV_HitCheck);
+
+    UWorld* World = GetWorld();
+    if (!World) return;
+
+    // 이전 프레임 위치 -> 현재 위치 (빠른 스윙도 사이 구간을 놓치지 않음)
+    const FTransform CurrentTransform = BoxComponent->GetComponentTransform();
+    const FVector Start = LastMeleeTransform.GetLocation();
+    const FVector End = CurrentTransform.GetLocation();
+    LastMeleeTransform = CurrentTransform;
+
+    const FVector Extent = BoxComponent->GetScaledBoxExtent() + FVector(MeleeExtentPadding);
+    const FCollisionShape Shape = Extent.IsNearlyZero()
+        ? FCollisionShape::MakeSphere(MeleeFallbackRadius)
+        : FCollisionShape::MakeBox(Extent);
+
+    // 여러 명 동시 판정
+    MeleeSweepHits.Reset();
+    XV_COUNT_TRACE();
+    World->SweepMultiByObjectType(MeleeSweepHits, Start, End, CurrentTransform.GetRotation(), MeleeObjectParams, Shape, MeleeQueryParams);
+
+    for (const FHitResult& Hit : MeleeSweepHits)
+    {
+        ApplyMeleeHit(Hit.GetActor());
+    }
+}
+
+void AAIWeaponMeleeBase::ApplyMeleeHit(AActor* HitActor)
+{
+    // 플레이어만, 스윙당 한 번만
+    AXVCharacter* Player = Cast<AXVCharacter>(HitActor);
+    if (!Player || MeleeHitActors.Contains(Player)) return;
+
+    // 첫 타격에서만 타격 사운드
+    if (MeleeHitActors.IsEmpty() && WeaponSound)
     {
-        AActor* HitActor = Hit.GetActor();
-        if (HitActor && HitActor->IsA(AXVCharacter::StaticClass()))
-        {
-            bPlayerHit = true;
-            if (WeaponSound)
-                WeaponSound->Play();
-            
-            AXVCharacter* Player = Cast<AXVCharacter>(HitActor);
-            AXVEnemyBase* Enemy = CastChecked<AXVEnemyBase>(GetOwner());
-            UAIStatusComponent* Component = Enemy->FindComponentByClass<UAIStatusComponent>();
-
-            float Damage = Component->AttackDamage;
-            Player->AddDamage(Damage);
-            break;
-        }
+        WeaponSound->Play();
     }
+    MeleeHitActors.Add(Player);
 
-    // 아무 타격이 없으면 미스 사운드 재생
-    if (!bPlayerHit)
+    AXVEnemyBase* Enemy = Cast<AXVEnemyBase>(GetOwner());
+    const UAIStatusComponent* Component = Enemy ? Enemy->FindComponentByClass<UAIStatusComponent>() : nullptr;
+    if (Component)
     {
-        if (NoHitSound)
-        {
-            GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Red, TEXT("TODO : Missed! Change Sound!"));
-            NoHitSound->Play();
-        }
+        Player->AddDamage(Component->AttackDamage);
     }
-}
\ No newline at end of file
+}
@@ -16,7 +16,20 @@ EWeaponType ABaseGun::GetWeaponType()
 void ABaseGun::BeginPlay()
 {
 	Super::BeginPlay();
-	
+
+	// 데미지/퍼짐 등 무기 수치 적용
+	LoadWeaponData();
+}
+
+void ABaseGun::OnEquipped(USceneComponent* Parent, FName SocketName)
+{
+	// 장착된 무기는 픽업 오버랩이 필요 없음
+	SetActorEnableCollision(false);
+	SetActorHiddenInGame(false);
+	if (Parent)
+	{
+		AttachToComponent(Parent, FAttachmentTransformRules::SnapToTargetNotIncludingScale, SocketName);
+	}
 }
 
 void ABaseGun::LoadWeaponData()
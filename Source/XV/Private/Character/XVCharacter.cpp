@@ -1,6 +1,9 @@
 #include "Character/XVCharacter.h"
+#include "XV.h"
 #include "Character/XVPlayerController.h"
+#include "Character/XVInputRecorderComponent.h"
 #include "Character/XVPlayerAnimInstance.h"
+#include "Character/XVCharacterMovementComponent.h"
 #include "EnhancedInputComponent.h"
 #include "Camera/CameraComponent.h"
 #include "BaseGun.h"
@@ -8,9 +11,18 @@
 #include "Components/CapsuleComponent.h"
 #include "GameFramework/SpringArmComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
-#include "Perception/AISense_Hearing.h" // AI 총소리 듣기 용입니다.
+#include "AI/System/Perception/XVNoiseAggregatorSubsystem.h" // AI 총소리 듣기 용입니다.
 
-AXVCharacter::AXVCharacter()
+namespace XVWeaponSockets
+{
+	static const FName PistolEquipped(TEXT("Pistol_Equipped"));
+	static const FName PistolUnequipped(TEXT("Pistol_Unequipped"));
+	static const FName RifleEquipped(TEXT("Rifle_Equipped"));
+	static const FName RifleUnequipped(TEXT("Rifle_Unequipped"));
+}
+
+AXVCharacter::AXVCharacter(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<UXVCharacterMovementComponent>(ACharacter::CharacterMovementComponentName))
 {
 	PrimaryActorTick.bCanEverTick = false;		
 	
@@ -30,11 +42,13 @@ AXVCharacter::AXVCharacter()
 	SprintSpeedMultiplier = 1.5f;
 	SprintSpeed = NormalSpeed * SprintSpeedMultiplier;
 
+	// 달리기/앉기/조준 속도 보간은 이동 컴포넌트가 이동 틱에서 처리
 	GetCharacterMovement()->MaxWalkSpeed = NormalSpeed;
 
 	// 메인 무기 == Rifle or Shotgun
 	PrimaryWeaponOffset = CreateDefaultSubobject<USceneComponent>(TEXT("PrimaryWeaponOffset"));
-	PrimaryWeaponOffset->SetupAttachment(GetMesh(), TEXT("Rifle_Unequipped"));
+	PrimaryWeaponOffset->SetupAttachment(GetMesh(), XVWeaponSockets::RifleUnequipped);
+	PrimaryOffsetSocket = XVWeaponSockets::RifleUnequipped;
 
 	PrimaryWeapon = CreateDefaultSubobject<UChildActorComponent>(TEXT("PrimaryWeapon"));
 	PrimaryWeapon->SetupAttachment(PrimaryWeaponOffset);
@@ -42,7 +56,8 @@ AXVCharacter::AXVCharacter()
 
 	// 서브 무기 == Pistol
 	SubWeaponOffset = CreateDefaultSubobject<USceneComponent>(TEXT("SubWeaponOffset"));
-	SubWeaponOffset->SetupAttachment(GetMesh(), TEXT("Pistol_Unequipped"));
+	SubWeaponOffset->SetupAttachment(GetMesh(), XVWeaponSockets::PistolUnequipped);
+	SubOffsetSocket = XVWeaponSockets::PistolUnequipped;
 
 	SubWeapon = CreateDefaultSubobject<UChildActorComponent>(TEXT("SubWeapon"));
 	SubWeapon->SetupAttachment(SubWeaponOffset);
@@ -62,6 +77,19 @@ AXVCharacter::AXVCharacter()
 	GetCapsuleComponent()->OnComponentEndOverlap.AddDynamic(this, &AXVCharacter::OnEndOverlap);
 }
 
+void AXVCharacter::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// 블루프린트에서 바꾼 값을 이동 컴포넌트에 반영
+	SprintSpeed = NormalSpeed * SprintSpeedMultiplier;
+	GetCharacterMovement()->MaxWalkSpeed = NormalSpeed;
+	GetXVCharacterMovement()->SprintSpeedMultiplier = SprintSpeedMultiplier;
+
+	DisableCarriedWeaponOverlaps(PrimaryWeapon->GetChildActor());
+	DisableCarriedWeaponOverlaps(SubWeapon->GetChildActor());
+}
+
 void AXVCharacter::SetHealth(float Value)
 {
 	CurrentHealth = FMath::Clamp( Value, 0.0f, MaxHealth);
@@ -84,43 +112,93 @@ void AXVCharacter::AddDamage(float Value)
 	// 피격 애니메이션 추가
 }
 
+const FXVWeaponSlotLayout& AXVCharacter::GetWeaponSlotLayout(EWeaponType Weapon)
+{
+	// 무기 타입별 배치는 한 번만 만들어 두고 재사용 (EWeaponType 순서와 동일)
+	static const FXVWeaponSlotLayout Layouts[] =
+	{
+		{ XVWeaponSockets::RifleUnequipped, XVWeaponSockets::PistolUnequipped, false }, // None
+		{ XVWeaponSockets::RifleUnequipped, XVWeaponSockets::PistolEquipped,   true  }, // Pistol
+		{ XVWeaponSockets::RifleEquipped,   XVWeaponSockets::PistolUnequipped, true  }, // Rifle
+		{ XVWeaponSockets::RifleEquipped,   XVWeaponSockets::PistolUnequipped, false }, // ShotGun
+	};
+
+	const int32 Index = static_cast<int32>(Weapon);
+	return Layouts[Index < static_cast<int32>(UE_ARRAY_COUNT(Layouts)) ? Index : 0];
+}
+
 void AXVCharacter::SetWeapon(EWeaponType Weapon)
-{ // 일단 타입마다 필요한게 있을 까 싶어 나눴는데 추가 기능 없으면 간략하게 변경해도 될듯
+{
 	CurrentWeaponType = Weapon;
 	FString WeaponTypeName = StaticEnum<EWeaponType>()->GetNameStringByValue((int64)CurrentWeaponType);
 	GEngine->AddOnScreenDebugMessage(-1, 5.f, FColor::Blue, WeaponTypeName);
 
-	auto anim = Cast<UXVPlayerAnimInstance>(GetMesh()->GetAnimInstance());
-	
-	switch (CurrentWeaponType)
+	const FXVWeaponSlotLayout& Layout = GetWeaponSlotLayout(CurrentWeaponType);
+
+	// 무기 교체 애니메이션 및 사운드 재생 필요
+	UXVPlayerAnimInstance* Anim = Cast<UXVPlayerAnimInstance>(GetMesh()->GetAnimInstance());
+	const bool bPlayedChangeAnim = Layout.bPlayChangeAnim && Anim && Anim->PlayGunChangeAnim();
+
+	// 노티파이 시점으로 미루는 경우 배치만 기록해 둠
+	PendingSlotWeaponType = CurrentWeaponType;
+	bHasPendingSlotLayout = true;
+	++PendingSlotSerial;
+	if (!bDeferWeaponSlotSwapToAnimNotify || !bPlayedChangeAnim)
 	{
-	case EWeaponType::Pistol:
-		// 무기 교체 애니메이션 및 사운드 재생 필요
-		SubWeaponOffset->AttachToComponent(GetMesh(), FAttachmentTransformRules::SnapToTargetNotIncludingScale, TEXT("Pistol_Equipped"));
-		PrimaryWeaponOffset->AttachToComponent(GetMesh(), FAttachmentTransformRules::SnapToTargetNotIncludingScale, TEXT("Rifle_Unequipped"));
-
-		anim->PlayGunChangeAnim();
-		break;
-		
-	case EWeaponType::Rifle:
-		// 무기 교체 애니메이션 및 사운드 재생 필요
-		SubWeaponOffset->AttachToComponent(GetMesh(), FAttachmentTransformRules::SnapToTargetNotIncludingScale, TEXT("Pistol_Unequipped"));
-		PrimaryWeaponOffset->AttachToComponent(GetMesh(), FAttachmentTransformRules::SnapToTargetNotIncludingScale, TEXT("Rifle_Equipped"));
-
-		anim->PlayGunChangeAnim();
-		break;
-
-	case EWeaponType::ShotGun:
-		// 무기 교체 애니메이션 및 사운드 재생 필요
-		SubWeaponOffset->AttachToComponent(GetMesh(), FAttachmentTransformRules::SnapToTargetNotIncludingScale, TEXT("Pistol_Unequipped"));
-		PrimaryWeaponOffset->AttachToComponent(GetMesh(), FAttachmentTransformRules::SnapToTargetNotIncludingScale, TEXT("Rifle_Equipped"));
-		break;
-	
-	default:
-		SubWeaponOffset->AttachToComponent(GetMesh(), FAttachmentTransformRules::SnapToTargetNotIncludingScale, TEXT("Pistol_Unequipped"));
-		PrimaryWeaponOffset->AttachToComponent(GetMesh(), FAttachmentTransformRules::SnapToTargetNotIncludingScale, TEXT("Rifle_Unequipped"));
-		break;
+		ApplyPendingWeaponSlotLayout();
+		return;
 	}
+
+	// 노티파이 전에 몽타주가 끊기거나 끝나도 배치가 남지 않도록 (이미 적용됐으면 무시됨)
+	FOnMontageBlendingOutStarted BlendingOutDelegate;
+	BlendingOutDelegate.BindUObject(this, &AXVCharacter::OnWeaponChangeMontageFinished, PendingSlotSerial);
+	Anim->Montage_SetBlendingOutDelegate(BlendingOutDelegate, Anim->ChangeAnimMontage);
+
+	FOnMontageEnded EndedDelegate;
+	EndedDelegate.BindUObject(this, &AXVCharacter::OnWeaponChangeMontageFinished, PendingSlotSerial);
+	Anim->Montage_SetEndDelegate(EndedDelegate, Anim->ChangeAnimMontage);
+}
+
+void AXVCharacter::OnWeaponChangeMontageFinished(UAnimMontage* Montage, bool bInterrupted, uint32 Serial)
+{
+	// 그 사이 다시 교체했다면 새 몽타주가 처리함
+	if (Serial != PendingSlotSerial) return;
+
+	ApplyPendingWeaponSlotLayout();
+}
+
+void AXVCharacter::ApplyPendingWeaponSlotLayout()
+{
+	if (!bHasPendingSlotLayout) return;
+
+	bHasPendingSlotLayout = false;
+	ApplyWeaponSlotLayout(GetWeaponSlotLayout(PendingSlotWeaponType));
+}
+
+void AXVCharacter::ApplyWeaponSlotLayout(const FXVWeaponSlotLayout& Layout)
+{
+	// 소켓이 실제로 바뀐 오프셋만 다시 붙임
+	if (PrimaryOffsetSocket != Layout.PrimarySocket)
+	{
+		PrimaryWeaponOffset->AttachToComponent(GetMesh(), FAttachmentTransformRules::SnapToTargetNotIncludingScale, Layout.PrimarySocket);
+		PrimaryOffsetSocket = Layout.PrimarySocket;
+	}
+
+	if (SubOffsetSocket != Layout.SubSocket)
+	{
+		SubWeaponOffset->AttachToComponent(GetMesh(), FAttachmentTransformRules::SnapToTargetNotIncludingScale, Layout.SubSocket);
+		SubOffsetSocket = Layout.SubSocket;
+	}
+}
+
+void AXVCharacter::DisableCarriedWeaponOverlaps(AActor* WeaponActor)
+{
+	if (!WeaponActor) return;
+
+	WeaponActor->ForEachComponent<UPrimitiveComponent>(false, [](UPrimitiveComponent* Primitive)
+	{
+		Primitive->SetGenerateOverlapEvents(false);
+	});
 }
 
 EWeaponType AXVCharacter::GetWeapon() const
@@ -138,6 +216,17 @@ bool AXVCharacter::GetIsSit() const
 	return bIsSit;
 }
 
+UXVCharacterMovementComponent* AXVCharacter::GetXVCharacterMovement() const
+{
+	return CastChecked<UXVCharacterMovementComponent>(GetCharacterMovement());
+}
+
+void AXVCharacter::SyncMovementStateMirrors(bool bInIsRun, bool bInIsSit)
+{
+	bIsRun = bInIsRun;
+	bIsSit = bInIsSit;
+}
+
 void AXVCharacter::OnWeaponOverlapBegin(ABaseGun* Weapon)
 {
 	CurrentOverlappingWeapon = Weapon;
@@ -194,6 +283,37 @@ void AXVCharacter::OnWeaponOverlapEnd(const ABaseGun* Weapon)
 	}
 }
 
+void AXVCharacter::EquipPrimaryWeapon(ABaseGun* NewWeapon)
+{
+	if (!NewWeapon || NewWeapon == EquippedPrimaryWeapon) return;
+
+	// 이전에 주운 무기는 다시 쓸 곳이 없으므로 제거 (새로 주운 무기는 파괴 없이 그대로 옮겨옴)
+	if (EquippedPrimaryWeapon)
+	{
+		EquippedPrimaryWeapon->Destroy();
+	}
+
+	// 기본으로 붙어 있던 자식 액터 무기는 숨기기만 함
+	if (AActor* DefaultWeapon = PrimaryWeapon->GetChildActor())
+	{
+		DefaultWeapon->SetActorHiddenInGame(true);
+		DefaultWeapon->SetActorEnableCollision(false);
+	}
+
+	EquippedPrimaryWeapon = NewWeapon;
+	EquippedPrimaryWeapon->SetOwner(this);
+	EquippedPrimaryWeapon->OnEquipped(PrimaryWeaponOffset);
+}
+
+ABaseGun* AXVCharacter::GetPrimaryWeaponActor() const
+{
+	if (EquippedPrimaryWeapon)
+	{
+		return EquippedPrimaryWeapon;
+	}
+	return Cast<ABaseGun>(PrimaryWeapon->GetChildActor());
+}
+
 void AXVCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
 {
 	Super::SetupPlayerInputComponent(PlayerInputComponent);
@@ -335,11 +455,39 @@ void AXVCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputCompone
             		this,
             		&AXVCharacter::OpenDoor
             	);
-            }	    	
+            }
+
+	    	// 성능 측정용 입력 녹화 (-XVRecordInput 일 때만 바인딩 추가)
+	    	if (UXVInputRecorderComponent* Recorder = PlayerController->GetInputRecorder())
+	    	{
+	    		Recorder->BindRecording(EnhancedInput);
+	    	}
 	    }
 	}
 }
 
+void AXVCharacter::DispatchRecordedInput(EXVRecordedInput Id, const FInputActionValue& Value)
+{
+	switch (Id)
+	{
+	case EXVRecordedInput::Move:               Move(Value); break;
+	case EXVRecordedInput::StartJump:          StartJump(Value); break;
+	case EXVRecordedInput::StopJump:           StopJump(Value); break;
+	case EXVRecordedInput::Look:               Look(Value); break;
+	case EXVRecordedInput::StartSprint:        StartSprint(Value); break;
+	case EXVRecordedInput::StopSprint:         StopSprint(Value); break;
+	case EXVRecordedInput::Fire:               Fire(Value); break;
+	case EXVRecordedInput::Sit:                Sit(Value); break;
+	case EXVRecordedInput::StartZoom:          StartZoom(Value); break;
+	case EXVRecordedInput::StopZoom:           StopZoom(Value); break;
+	case EXVRecordedInput::PickUpWeapon:       PickUpWeapon(Value); break;
+	case EXVRecordedInput::ChangeToMainWeapon: ChangeToMainWeapon(Value); break;
+	case EXVRecordedInput::ChangeToSubWeapon:  ChangeToSubWeapon(Value); break;
+	case EXVRecordedInput::OpenDoor:           OpenDoor(Value); break;
+	default: break;
+	}
+}
+
 void AXVCharacter::Move(const FInputActionValue& value)
 {
 	if (!Controller) return;
@@ -383,46 +531,25 @@ void AXVCharacter::Look(const FInputActionValue& value)
 
 void AXVCharacter::StartSprint(const FInputActionValue& value)
 {
-	if (GetCharacterMovement())
-	{
-		GetCharacterMovement()->MaxWalkSpeed = SprintSpeed;
-		bIsRun = true;
-	}
+	GetXVCharacterMovement()->SetWantsToSprint(true);
 }
 
 void AXVCharacter::StopSprint(const FInputActionValue& value)
 {
-	TargetWalkSpeed = NormalSpeed;
-	CurrentWalkSpeed = GetCharacterMovement()->MaxWalkSpeed;
-	bIsRun = false;
-}
-
-void AXVCharacter::InterpWalkSpeed()
-{
-	if (!GetCharacterMovement()) return;
-
-	// 보간
-	CurrentWalkSpeed = FMath::FInterpTo(CurrentWalkSpeed, TargetWalkSpeed, GetWorld()->GetDeltaSeconds(), InterpSpeed);
-	GetCharacterMovement()->MaxWalkSpeed = CurrentWalkSpeed;
-	
-	// 충분히 가까워지면 보간 종료
-	if (FMath::IsNearlyEqual(CurrentWalkSpeed, TargetWalkSpeed, 1.0f))
-	{
-		GetCharacterMovement()->MaxWalkSpeed = TargetWalkSpeed;
-		GetWorld()->GetTimerManager().ClearTimer(WalkSpeedInterpTimerHandle);
-		bIsRun = false;
-	}
+	GetXVCharacterMovement()->SetWantsToSprint(false);
 }
 
 void AXVCharacter::Fire(const FInputActionValue& value)
 {
+	XV_SCOPE_CYCLE_COUNTER(STAT_XV_WeaponFire);
+
 	if (value.Get<bool>())
 	{
 		GEngine->AddOnScreenDebugMessage(-1, 5.f, FColor::Blue, TEXT("Fire"));
 		auto anim = Cast<UXVPlayerAnimInstance>(GetMesh()->GetAnimInstance());
 		anim->PlayAttackAnim();
 
-		ABaseGun* Weapon = Cast<ABaseGun>(PrimaryWeapon->GetChildActor());
+		ABaseGun* Weapon = GetPrimaryWeaponActor();
 		if (Weapon)
 		{
 			Weapon->FireBullet();
@@ -431,30 +558,27 @@ void AXVCharacter::Fire(const FInputActionValue& value)
 		auto controller = GetWorld()->GetFirstPlayerController();
 		controller->PlayerCameraManager->StartCameraShake(CameraShake);
 
-		// AI 소리 듣기용입니다.
-		UAISense_Hearing::ReportNoiseEvent
-		(
-		GetWorld(),
-		GetActorLocation(),			 // 소리 발생 위치
-		1.0f,						 // 소리 Loudness (1.0은 일반, 더 크면 더 멀리 들림)
-		this,						 // 소리 낸 Actor
-		0.f,						 // 일정 지연시간
-		FName(TEXT("WeaponFire"))	 // 이벤트 식별 태그(선택)
-		);
+		// AI 소리 듣기용입니다. (연사 시 윈도우 단위로 묶어서 보고)
+		if (UXVNoiseAggregatorSubsystem* NoiseAggregator = GetWorld()->GetSubsystem<UXVNoiseAggregatorSubsystem>())
+		{
+			static const FName WeaponFireNoiseTag(TEXT("WeaponFire"));
+			NoiseAggregator->ReportNoise(this, GetActorLocation(), FireNoiseLoudness, WeaponFireNoiseTag, FireNoiseWindow);
+		}
 	}
 }
 
 void AXVCharacter::Sit(const FInputActionValue& value)
 {
-	if (!bIsSit)
+	UXVCharacterMovementComponent* Movement = GetXVCharacterMovement();
+	if (!Movement->WantsToSit())
 	{
 		GEngine->AddOnScreenDebugMessage(-1, 5.f, FColor::Blue, TEXT("Sit"));
-		bIsSit = true;
+		Movement->SetWantsToSit(true);
 	}
 	else
 	{
 		GEngine->AddOnScreenDebugMessage(-1, 5.f, FColor::Blue, TEXT("Stand"));
-		bIsSit = false;
+		Movement->SetWantsToSit(false);
 	}
 }
 
@@ -463,6 +587,7 @@ void AXVCharacter::StartZoom(const FInputActionValue& value)
 	if (value.Get<bool>())
 	{
 		SpringArmComp->TargetArmLength = ZoomCameraLenght;
+		GetXVCharacterMovement()->SetWantsToAim(true);
 	}
 }
 
@@ -471,6 +596,7 @@ void AXVCharacter::StopZoom(const FInputActionValue& value)
 	if (!value.Get<bool>())
 	{
 		SpringArmComp->TargetArmLength = DefaultCameraLenght;
+		GetXVCharacterMovement()->SetWantsToAim(false);
 	}
 }
 
@@ -485,12 +611,13 @@ void AXVCharacter::PickUpWeapon(const FInputActionValue& value)
 			CurrentWeaponType = MainWeaponType;
 			UE_LOG(LogTemp, Log, TEXT("Picked up Weapon Type: %d"), (uint8)CurrentWeaponType);
 
-			SetWeapon(CurrentWeaponType);
-			
-			// 무기 액터 파괴
-			CurrentOverlappingWeapon->Destroy();
+			// 무기 액터를 파괴하지 않고 그대로 주 무기 슬롯으로 이동
+			ABaseGun* PickedWeapon = CurrentOverlappingWeapon;
 			// 무기 획득 후 오버랩 무기 초기화
 			CurrentOverlappingWeapon = nullptr;
+			EquipPrimaryWeapon(PickedWeapon);
+
+			SetWeapon(CurrentWeaponType);
 		}
 	}
 }
@@ -0,0 +1,314 @@
+#include "Character/XVCharacterMovementComponent.h"
+#include "Character/XVCharacter.h"
+#include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
+
+namespace XVMoveState
+{
+	static constexpr uint8 Sprint = 1 << 0;
+	static constexpr uint8 Sit = 1 << 1;
+	static constexpr uint8 Aim = 1 << 2;
+}
+
+// 이동 하나를 재시뮬레이션할 때 필요한 상태 (보정 후 재생 시 이 값으로 되돌림, 서버에는 압축 플래그로 전송)
+class FXVSavedMove_Character : public FSavedMove_Character
+{
+public:
+	typedef FSavedMove_Character Super;
+
+	virtual void Clear() override
+	{
+		Super::Clear();
+
+		bSavedWantsToSprint = false;
+		bSavedWantsToSit = false;
+		bSavedWantsToAim = false;
+		SavedBlendedWalkSpeed = -1.f;
+	}
+
+	virtual void SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData) override
+	{
+		Super::SetMoveFor(C, InDeltaTime, NewAccel, ClientData);
+
+		// 이동 실행 전에 호출되므로 보간 시작 속도가 저장됨
+		const UXVCharacterMovementComponent* Movement = CastChecked<UXVCharacterMovementComponent>(C->GetCharacterMovement());
+		bSavedWantsToSprint = Movement->bWantsToSprint;
+		bSavedWantsToSit = Movement->bWantsToSit;
+		bSavedWantsToAim = Movement->bWantsToAim;
+		SavedBlendedWalkSpeed = Movement->BlendedWalkSpeed;
+	}
+
+	virtual bool CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const override
+	{
+		const FXVSavedMove_Character* Other = static_cast<const FXVSavedMove_Character*>(NewMove.Get());
+		if (bSavedWantsToSprint != Other->bSavedWantsToSprint
+			|| bSavedWantsToSit != Other->bSavedWantsToSit
+			|| bSavedWantsToAim != Other->bSavedWantsToAim)
+		{
+			return false;
+		}
+
+		// 보간 중인 이동은 합치면 결과가 달라지므로 속도가 안정된 뒤에만 합침
+		if (!FMath::IsNearlyEqual(SavedBlendedWalkSpeed, Other->SavedBlendedWalkSpeed, 1.f))
+		{
+			return false;
+		}
+
+		return Super::CanCombineWith(NewMove, InCharacter, MaxDelta);
+	}
+
+	virtual uint8 GetCompressedFlags() const override
+	{
+		// 기존 플래그 바이트의 빈 비트만 사용 (이동당 추가 대역폭 없음)
+		uint8 Result = Super::GetCompressedFlags();
+		if (bSavedWantsToSprint) Result |= FLAG_Custom_0;
+		if (bSavedWantsToSit)    Result |= FLAG_Custom_1;
+		if (bSavedWantsToAim)    Result |= FLAG_Custom_2;
+		return Result;
+	}
+
+	virtual void PrepMoveFor(ACharacter* C) override
+	{
+		Super::PrepMoveFor(C);
+
+		UXVCharacterMovementComponent* Movement = CastChecked<UXVCharacterMovementComponent>(C->GetCharacterMovement());
+		Movement->bWantsToSprint = bSavedWantsToSprint;
+		Movement->bWantsToSit = bSavedWantsToSit;
+		Movement->bWantsToAim = bSavedWantsToAim;
+		// 보간 속도는 되돌리지 않음 (보정 시 서버 값에서 시작해 재생하면서 이어서 보간)
+	}
+
+	bool bSavedWantsToSprint = false;
+	bool bSavedWantsToSit = false;
+	bool bSavedWantsToAim = false;
+	// 이동 합치기 판단용
+	float SavedBlendedWalkSpeed = -1.f;
+};
+
+class FXVNetworkPredictionData_Client_Character : public FNetworkPredictionData_Client_Character
+{
+public:
+	typedef FNetworkPredictionData_Client_Character Super;
+
+	explicit FXVNetworkPredictionData_Client_Character(const UCharacterMovementComponent& ClientMovement)
+		: Super(ClientMovement)
+	{
+	}
+
+	virtual FSavedMovePtr AllocateNewMove() override
+	{
+		return FSavedMovePtr(new FXVSavedMove_Character());
+	}
+};
+
+UXVCharacterMovementComponent::UXVCharacterMovementComponent()
+	: SprintSpeedMultiplier(1.5f)
+	, SitSpeedMultiplier(0.5f)
+	, AimSpeedMultiplier(0.6f)
+	, SpeedBlendRate(6.f)
+	, bWantsToSprint(false)
+	, bWantsToSit(false)
+	, bWantsToAim(false)
+{
+	SetMoveResponseDataContainer(XVMoveResponseDataContainer);
+}
+
+void FXVCharacterMoveResponseDataContainer::ServerFillResponseData(const UCharacterMovementComponent& CharacterMovement, const FClientAdjustment& PendingAdjustment)
+{
+	Super::ServerFillResponseData(CharacterMovement, PendingAdjustment);
+
+	BlendedWalkSpeed = static_cast<const UXVCharacterMovementComponent&>(CharacterMovement).GetBlendedWalkSpeed();
+}
+
+bool FXVCharacterMoveResponseDataContainer::Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap)
+{
+	if (!Super::Serialize(CharacterMovement, Ar, PackageMap)) return false;
+
+	// 정상 이동(ACK)에는 싣지 않음
+	if (IsCorrection())
+	{
+		Ar << BlendedWalkSpeed;
+	}
+	return !Ar.IsError();
+}
+
+void UXVCharacterMovementComponent::SetWantsToSprint(bool bWants)
+{
+	bWantsToSprint = bWants;
+	SyncOwnerMirrors();
+}
+
+void UXVCharacterMovementComponent::SetWantsToSit(bool bWants)
+{
+	bWantsToSit = bWants;
+	SyncOwnerMirrors();
+}
+
+void UXVCharacterMovementComponent::SetWantsToAim(bool bWants)
+{
+	bWantsToAim = bWants;
+	SyncOwnerMirrors();
+}
+
+float UXVCharacterMovementComponent::GetTargetWalkSpeed() const
+{
+	// 앉기/조준 중에는 달리기 무시
+	if (bWantsToSit)
+	{
+		return MaxWalkSpeed * SitSpeedMultiplier;
+	}
+	if (bWantsToAim)
+	{
+		return MaxWalkSpeed * AimSpeedMultiplier;
+	}
+	if (bWantsToSprint)
+	{
+		return MaxWalkSpeed * SprintSpeedMultiplier;
+	}
+	return MaxWalkSpeed;
+}
+
+float UXVCharacterMovementComponent::GetMaxSpeed() const
+{
+	switch (MovementMode)
+	{
+	case MOVE_Walking:
+	case MOVE_NavWalking:
+	case MOVE_Falling:
+		if (IsCrouching())
+		{
+			return Super::GetMaxSpeed();
+		}
+		// 점프 중에도 지상 속도를 유지 (달리다 점프하면 공중에서 감속되지 않도록)
+		return BlendedWalkSpeed >= 0.f ? BlendedWalkSpeed : GetTargetWalkSpeed();
+	default:
+		return Super::GetMaxSpeed();
+	}
+}
+
+void UXVCharacterMovementComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	// 조종하는 클라이언트는 직접 예측하므로 시뮬레이티드 프록시에만 전송 (Push Model)
+	FDoRepLifetimeParams Params;
+	Params.Condition = COND_SimulatedOnly;
+	Params.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(UXVCharacterMovementComponent, ReplicatedMoveState, Params);
+}
+
+FNetworkPredictionData_Client* UXVCharacterMovementComponent::GetPredictionData_Client() const
+{
+	if (!ClientPredictionData)
+	{
+		UXVCharacterMovementComponent* MutableThis = const_cast<UXVCharacterMovementComponent*>(this);
+		MutableThis->ClientPredictionData = new FXVNetworkPredictionData_Client_Character(*this);
+	}
+	return ClientPredictionData;
+}
+
+void UXVCharacterMovementComponent::UpdateCharacterStateBeforeMovement(float DeltaSeconds)
+{
+	Super::UpdateCharacterStateBeforeMovement(DeltaSeconds);
+
+	const float TargetWalkSpeed = GetTargetWalkSpeed();
+	if (BlendedWalkSpeed < 0.f)
+	{
+		BlendedWalkSpeed = TargetWalkSpeed;
+		return;
+	}
+
+	BlendedWalkSpeed = FMath::FInterpTo(BlendedWalkSpeed, TargetWalkSpeed, DeltaSeconds, SpeedBlendRate);
+
+	// 충분히 가까워지면 목표 속도로 고정 (세이브 무브를 다시 합칠 수 있도록)
+	if (FMath::IsNearlyEqual(BlendedWalkSpeed, TargetWalkSpeed, 1.f))
+	{
+		BlendedWalkSpeed = TargetWalkSpeed;
+	}
+}
+
+void UXVCharacterMovementComponent::UpdateFromCompressedFlags(uint8 Flags)
+{
+	Super::UpdateFromCompressedFlags(Flags);
+
+	// 서버 : 클라이언트가 보낸 상태를 이 이동에 적용
+	bWantsToSprint = (Flags & FSavedMove_Character::FLAG_Custom_0) != 0;
+	bWantsToSit = (Flags & FSavedMove_Character::FLAG_Custom_1) != 0;
+	bWantsToAim = (Flags & FSavedMove_Character::FLAG_Custom_2) != 0;
+}
+
+void UXVCharacterMovementComponent::OnMovementUpdated(float DeltaSeconds, const FVector& OldLocation, const FVector& OldVelocity)
+{
+	Super::OnMovementUpdated(DeltaSeconds, OldLocation, OldVelocity);
+
+	// 서버 : 압축 플래그로 받은 상태 / 클라이언트 : 재생 후 복원된 상태
+	SyncOwnerMirrors();
+
+	if (GetOwnerRole() == ROLE_Authority)
+	{
+		const uint8 NewState = PackMoveState();
+		if (ReplicatedMoveState != NewState)
+		{
+			ReplicatedMoveState = NewState;
+			MARK_PROPERTY_DIRTY_FROM_NAME(UXVCharacterMovementComponent, ReplicatedMoveState, this);
+		}
+	}
+}
+
+void UXVCharacterMovementComponent::ClientHandleMoveResponse(const FCharacterMoveResponseDataContainer& MoveResponse)
+{
+	// 보정이면 서버가 확인한 이동 직후의 보간 속도에서 다시 시작
+	if (MoveResponse.IsCorrection())
+	{
+		BlendedWalkSpeed = static_cast<const FXVCharacterMoveResponseDataContainer&>(MoveResponse).BlendedWalkSpeed;
+	}
+
+	Super::ClientHandleMoveResponse(MoveResponse);
+}
+
+bool UXVCharacterMovementComponent::ClientUpdatePositionAfterServerUpdate()
+{
+	// 재생이 세이브 무브의 상태로 덮어쓰므로 현재 입력 상태를 보관했다가 복원
+	const bool bRealWantsToSprint = bWantsToSprint;
+	const bool bRealWantsToSit = bWantsToSit;
+	const bool bRealWantsToAim = bWantsToAim;
+
+	const bool bResult = Super::ClientUpdatePositionAfterServerUpdate();
+
+	bWantsToSprint = bRealWantsToSprint;
+	bWantsToSit = bRealWantsToSit;
+	bWantsToAim = bRealWantsToAim;
+	SyncOwnerMirrors();
+
+	return bResult;
+}
+
+uint8 UXVCharacterMovementComponent::PackMoveState() const
+{
+	uint8 State = 0;
+	if (bWantsToSprint) State |= XVMoveState::Sprint;
+	if (bWantsToSit)    State |= XVMoveState::Sit;
+	if (bWantsToAim)    State |= XVMoveState::Aim;
+	return State;
+}
+
+void UXVCharacterMovementComponent::UnpackMoveState(uint8 State)
+{
+	bWantsToSprint = (State & XVMoveState::Sprint) != 0;
+	bWantsToSit = (State & XVMoveState::Sit) != 0;
+	bWantsToAim = (State & XVMoveState::Aim) != 0;
+}
+
+void UXVCharacterMovementComponent::OnRep_MoveState()
+{
+	UnpackMoveState(ReplicatedMoveState);
+	SyncOwnerMirrors();
+}
+
+void UXVCharacterMovementComponent::SyncOwnerMirrors() const
+{
+	if (AXVCharacter* XVCharacter = Cast<AXVCharacter>(CharacterOwner))
+	{
+		XVCharacter->SyncMovementStateMirrors(IsSprinting(), bWantsToSit);
+	}
+}
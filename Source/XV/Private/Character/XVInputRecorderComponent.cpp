@@ -0,0 +1,413 @@
+#include "Character/XVInputRecorderComponent.h"
+#include "XV.h"
+#include "Character/XVCharacter.h"
+#include "Character/XVPlayerController.h"
+#include "System/XVRandomStreamSubsystem.h"
+#include "EnhancedInputComponent.h"
+#include "GameFramework/PawnMovementComponent.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace XVInputRecorder
+{
+	struct FBinding
+	{
+		UInputAction* AXVPlayerController::* Action;
+		ETriggerEvent TriggerEvent;
+		EXVRecordedInput Id;
+	};
+
+	// AXVCharacter::SetupPlayerInputComponent 의 바인딩과 같은 구성
+	static const FBinding Bindings[] =
+	{
+		{ &AXVPlayerController::MoveAction,       ETriggerEvent::Triggered, EXVRecordedInput::Move },
+		{ &AXVPlayerController::JumpAction,       ETriggerEvent::Triggered, EXVRecordedInput::StartJump },
+		{ &AXVPlayerController::JumpAction,       ETriggerEvent::Completed, EXVRecordedInput::StopJump },
+		{ &AXVPlayerController::LookAction,       ETriggerEvent::Triggered, EXVRecordedInput::Look },
+		{ &AXVPlayerController::SprintAction,     ETriggerEvent::Triggered, EXVRecordedInput::StartSprint },
+		{ &AXVPlayerController::SprintAction,     ETriggerEvent::Completed, EXVRecordedInput::StopSprint },
+		{ &AXVPlayerController::FireAction,       ETriggerEvent::Triggered, EXVRecordedInput::Fire },
+		{ &AXVPlayerController::ZoomAction,       ETriggerEvent::Triggered, EXVRecordedInput::StartZoom },
+		{ &AXVPlayerController::ZoomAction,       ETriggerEvent::Completed, EXVRecordedInput::StopZoom },
+		{ &AXVPlayerController::SitAction,        ETriggerEvent::Started,   EXVRecordedInput::Sit },
+		{ &AXVPlayerController::PickUpAction,     ETriggerEvent::Started,   EXVRecordedInput::PickUpWeapon },
+		{ &AXVPlayerController::MainWeaponAction, ETriggerEvent::Started,   EXVRecordedInput::ChangeToMainWeapon },
+		{ &AXVPlayerController::SubWeaponAction,  ETriggerEvent::Started,   EXVRecordedInput::ChangeToSubWeapon },
+		{ &AXVPlayerController::OpenDoorAction,   ETriggerEvent::Started,   EXVRecordedInput::OpenDoor },
+	};
+
+	static float Percentile(TArray<float> Values, float Ratio)
+	{
+		if (Values.IsEmpty()) return 0.f;
+		Values.Sort();
+		const int32 Index = FMath::Clamp(FMath::CeilToInt(Ratio * Values.Num()) - 1, 0, Values.Num() - 1);
+		return Values[Index];
+	}
+}
+
+UXVInputRecorderComponent::UXVInputRecorderComponent()
+{
+	// 재생 모드에서만 틱을 켬
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+	PrimaryComponentTick.TickGroup = TG_PrePhysics;
+}
+
+bool UXVInputRecorderComponent::IsReplayRequested()
+{
+	FString Path;
+	return FParse::Value(FCommandLine::Get(), TEXT("XVReplayInput="), Path);
+}
+
+bool UXVInputRecorderComponent::IsRecordRequested()
+{
+	// 재생이 우선 (BeginPlay 와 같은 순서), -XVRecordInput 과 -XVRecordInput=경로 둘 다 허용
+	if (IsReplayRequested()) return false;
+
+	FString Path;
+	return FParse::Value(FCommandLine::Get(), TEXT("XVRecordInput="), Path) || FParse::Param(FCommandLine::Get(), TEXT("XVRecordInput"));
+}
+
+bool UXVInputRecorderComponent::GetReplaySeed(int32& OutSeed)
+{
+	FString Path;
+	if (!FParse::Value(FCommandLine::Get(), TEXT("XVReplayInput="), Path)) return false;
+
+	// 헤더만 필요하므로 파일 앞부분만 읽음
+	TUniquePtr<FArchive> Ar(IFileManager::Get().CreateFileReader(*Path));
+	if (!Ar) return false;
+
+	uint32 Magic = 0;
+	uint16 Version = 0;
+	int32 Seed = 0;
+	*Ar << Magic << Version;
+	if (Magic != FileMagic || Version != FileVersion) return false;
+	*Ar << Seed;
+	if (Ar->IsError()) return false;
+
+	OutSeed = Seed;
+	return true;
+}
+
+void UXVInputRecorderComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// 로컬 플레이어 컨트롤러만 대상 (서버의 원격 플레이어 컨트롤러는 무시)
+	const APlayerController* PlayerController = Cast<APlayerController>(GetOwner());
+	if (!PlayerController || !PlayerController->IsLocalController()) return;
+
+	const TCHAR* CommandLine = FCommandLine::Get();
+	StartTime = GetWorld()->GetTimeSeconds();
+
+	if (FParse::Value(CommandLine, TEXT("XVReplayInput="), FilePath))
+	{
+		FParse::Value(CommandLine, TEXT("XVReplayFPS="), ReplayFPS);
+		bExitOnFinish = !FParse::Param(CommandLine, TEXT("XVReplayNoExit"));
+		if (!FParse::Value(CommandLine, TEXT("XVReplayCSV="), CSVPath))
+		{
+			CSVPath = FPaths::ProjectSavedDir() / TEXT("Profiling") / FString::Printf(TEXT("XVReplay_%s.csv"), *FDateTime::Now().ToString());
+		}
+
+		if (LoadRecording())
+		{
+			StartReplay();
+		}
+		return;
+	}
+
+	if (IsRecordRequested())
+	{
+		if (!FParse::Value(CommandLine, TEXT("XVRecordInput="), FilePath))
+		{
+			FilePath = FPaths::ProjectSavedDir() / TEXT("Profiling") / FString::Printf(TEXT("XVInput_%s.xvinput"), *FDateTime::Now().ToString());
+		}
+
+		Events.Reserve(16 * 1024);
+		bRecording = true;
+		UE_LOG(LogTemp, Display, TEXT("[XVInputRecorder] Recording to %s"), *FilePath);
+	}
+}
+
+void UXVInputRecorderComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (bRecording)
+	{
+		bRecording = false;
+		RecordedDuration = static_cast<float>(GetWorld()->GetTimeSeconds() - StartTime);
+		SaveRecording();
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UXVInputRecorderComponent::BindRecording(UEnhancedInputComponent* EnhancedInput)
+{
+	// GameMode 의 RestartPlayer(빙의)가 BeginPlay 보다 먼저라서 bRecording 대신 커맨드라인으로 판단
+	// 녹화 시작 전에 들어온 입력은 RecordInput 에서 버림
+	AXVPlayerController* PlayerController = Cast<AXVPlayerController>(GetOwner());
+	if (!EnhancedInput || !PlayerController || !PlayerController->IsLocalController() || !IsRecordRequested()) return;
+
+	for (const XVInputRecorder::FBinding& Binding : XVInputRecorder::Bindings)
+	{
+		if (const UInputAction* Action = PlayerController->*Binding.Action)
+		{
+			EnhancedInput->BindActionValueLambda(Action, Binding.TriggerEvent,
+				[WeakThis = TWeakObjectPtr<UXVInputRecorderComponent>(this), Id = Binding.Id](const FInputActionValue& Value)
+				{
+					if (UXVInputRecorderComponent* Recorder = WeakThis.Get())
+					{
+						Recorder->RecordInput(Id, Value);
+					}
+				});
+		}
+	}
+}
+
+void UXVInputRecorderComponent::RecordInput(EXVRecordedInput Id, const FInputActionValue& Value)
+{
+	if (!bRecording) return;
+
+	FXVRecordedInputEvent& Event = Events.AddDefaulted_GetRef();
+	Event.Time = static_cast<float>(GetWorld()->GetTimeSeconds() - StartTime);
+	Event.Id = Id;
+	Event.Value = Value;
+}
+
+bool UXVInputRecorderComponent::SaveRecording() const
+{
+	TArray<uint8> Bytes;
+	Bytes.Reserve(64 + Events.Num() * 14);
+	FMemoryWriter Ar(Bytes);
+
+	uint32 Magic = FileMagic;
+	uint16 Version = FileVersion;
+	int32 Seed = 0;
+	if (const UXVRandomStreamSubsystem* RandomStream = GetWorld()->GetSubsystem<UXVRandomStreamSubsystem>())
+	{
+		Seed = RandomStream->GetSeed();
+	}
+	FString MapName = UGameplayStatics::GetCurrentLevelName(this);
+	float Duration = RecordedDuration;
+	int32 EventCount = Events.Num();
+	Ar << Magic << Version << Seed << MapName << Duration << EventCount;
+
+	for (const FXVRecordedInputEvent& Event : Events)
+	{
+		float Time = Event.Time;
+		uint8 Id = static_cast<uint8>(Event.Id);
+		uint8 ValueType = static_cast<uint8>(Event.Value.GetValueType());
+		Ar << Time << Id << ValueType;
+
+		// Axis1D/2D/3D 는 값 타입 번호가 곧 축 개수
+		if (Event.Value.GetValueType() == EInputActionValueType::Boolean)
+		{
+			uint8 bPressed = Event.Value.Get<bool>() ? 1 : 0;
+			Ar << bPressed;
+		}
+		else
+		{
+			const FVector Axis = Event.Value.Get<FVector>();
+			for (int32 i = 0; i < ValueType; i++)
+			{
+				float Component = static_cast<float>(Axis[i]);
+				Ar << Component;
+			}
+		}
+	}
+
+	if (!FFileHelper::SaveArrayToFile(Bytes, *FilePath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[XVInputRecorder] Failed to write %s"), *FilePath);
+		return false;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("[XVInputRecorder] Saved %d events (%.1fs, %d bytes, Seed=%d) to %s"),
+		EventCount, Duration, Bytes.Num(), Seed, *FilePath);
+	return true;
+}
+
+bool UXVInputRecorderComponent::LoadRecording()
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *FilePath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[XVInputRecorder] Failed to read %s"), *FilePath);
+		return false;
+	}
+
+	FMemoryReader Ar(Bytes);
+	uint32 Magic = 0;
+	uint16 Version = 0;
+	int32 EventCount = 0;
+	Ar << Magic << Version;
+	if (Magic != FileMagic || Version != FileVersion)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[XVInputRecorder] %s is not a supported input recording (Magic=%08x Version=%d)"), *FilePath, Magic, Version);
+		return false;
+	}
+	Ar << RecordedSeed << RecordedMapName << RecordedDuration << EventCount;
+
+	Events.Reset(FMath::Max(EventCount, 0));
+	for (int32 i = 0; i < EventCount && !Ar.IsError(); i++)
+	{
+		float Time = 0.f;
+		uint8 Id = 0;
+		uint8 ValueType = 0;
+		Ar << Time << Id << ValueType;
+		if (Id >= static_cast<uint8>(EXVRecordedInput::Max) || ValueType > static_cast<uint8>(EInputActionValueType::Axis3D))
+		{
+			Ar.SetError();
+			break;
+		}
+
+		FXVRecordedInputEvent& Event = Events.AddDefaulted_GetRef();
+		Event.Time = Time;
+		Event.Id = static_cast<EXVRecordedInput>(Id);
+
+		if (ValueType == static_cast<uint8>(EInputActionValueType::Boolean))
+		{
+			uint8 bPressed = 0;
+			Ar << bPressed;
+			Event.Value = FInputActionValue(bPressed != 0);
+		}
+		else
+		{
+			FVector Axis = FVector::ZeroVector;
+			for (int32 AxisIndex = 0; AxisIndex < ValueType; AxisIndex++)
+			{
+				float Component = 0.f;
+				Ar << Component;
+				Axis[AxisIndex] = Component;
+			}
+			Event.Value = FInputActionValue(static_cast<EInputActionValueType>(ValueType), Axis);
+		}
+	}
+
+	if (Ar.IsError())
+	{
+		UE_LOG(LogTemp, Error, TEXT("[XVInputRecorder] %s is corrupted"), *FilePath);
+		Events.Reset();
+		return false;
+	}
+	return true;
+}
+
+void UXVInputRecorderComponent::StartReplay()
+{
+	const FString MapName = UGameplayStatics::GetCurrentLevelName(this);
+	if (MapName != RecordedMapName)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[XVInputRecorder] Recording was made on %s but current map is %s"), *RecordedMapName, *MapName);
+	}
+
+	// 시드는 월드 초기화 때 녹화 파일 값으로 이미 적용됨 (여기서 바꾸면 이미 스폰된 웨이브와 어긋나므로 경고만)
+	if (const UXVRandomStreamSubsystem* RandomStream = GetWorld()->GetSubsystem<UXVRandomStreamSubsystem>())
+	{
+		if (RandomStream->GetSeed() != RecordedSeed)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[XVInputRecorder] World seed %d differs from recorded seed %d (-XVSeed overrides the recording), results will not match"), RandomStream->GetSeed(), RecordedSeed);
+		}
+	}
+
+	// 게임 시간을 고정 스텝으로 진행 (실제 프레임 시간과 상관없이 같은 입력이 같은 게임 시간에 들어감)
+	ReplayFPS = FMath::Max(ReplayFPS, 1.f);
+	FApp::SetUseFixedTimeStep(true);
+	FApp::SetFixedDeltaTime(1.0 / ReplayFPS);
+
+	const int32 ExpectedFrames = FMath::CeilToInt(RecordedDuration * ReplayFPS) + 1;
+	FrameMs.Reserve(ExpectedFrames);
+	GameThreadMs.Reserve(ExpectedFrames);
+
+	NextEventIndex = 0;
+	bReplaying = true;
+	SetComponentTickEnabled(true);
+
+	UE_LOG(LogTemp, Display, TEXT("[XVInputRecorder] Replaying %d events (%.1fs) from %s at %.0f fps"), Events.Num(), RecordedDuration, *FilePath, ReplayFPS);
+}
+
+void UXVInputRecorderComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	if (!bReplaying) return;
+
+	AXVCharacter* Character = ReplayCharacter.Get();
+	if (!Character)
+	{
+		const APlayerController* PlayerController = Cast<APlayerController>(GetOwner());
+		Character = PlayerController ? Cast<AXVCharacter>(PlayerController->GetPawn()) : nullptr;
+		if (!Character) return;
+
+		// 같은 프레임에 넣은 이동 입력이 이동 컴포넌트에서 소비되도록 먼저 틱
+		if (UPawnMovementComponent* Movement = Character->GetMovementComponent())
+		{
+			Movement->AddTickPrerequisiteComponent(this);
+		}
+		ReplayCharacter = Character;
+	}
+
+	const float Elapsed = static_cast<float>(GetWorld()->GetTimeSeconds() - StartTime);
+	while (NextEventIndex < Events.Num() && Events[NextEventIndex].Time <= Elapsed)
+	{
+		const FXVRecordedInputEvent& Event = Events[NextEventIndex++];
+		Character->DispatchRecordedInput(Event.Id, Event.Value);
+	}
+
+	RecordFrameTime();
+
+	if (NextEventIndex >= Events.Num() && Elapsed >= RecordedDuration)
+	{
+		FinishReplay();
+	}
+}
+
+void UXVInputRecorderComponent::RecordFrameTime()
+{
+	// 고정 스텝에서는 DeltaTime 이 일정하므로 실제 시간으로 측정
+	const double WallTime = FPlatformTime::Seconds();
+	if (LastFrameWallTime > 0.0)
+	{
+		const float Ms = static_cast<float>((WallTime - LastFrameWallTime) * 1000.0);
+		FrameMs.Add(Ms);
+		GameThreadMs.Add(XVProfiling::GetGameThreadMs());
+	}
+	LastFrameWallTime = WallTime;
+}
+
+void UXVInputRecorderComponent::FinishReplay()
+{
+	bReplaying = false;
+	SetComponentTickEnabled(false);
+
+	FString CSV = TEXT("Frame,Time,FrameMs,GameThreadMs\n");
+	CSV.Reserve(CSV.Len() + FrameMs.Num() * 32);
+	for (int32 i = 0; i < FrameMs.Num(); i++)
+	{
+		CSV += FString::Printf(TEXT("%d,%.3f,%.3f,%.3f\n"), i, (i + 1) / ReplayFPS, FrameMs[i], GameThreadMs[i]);
+	}
+
+	if (FFileHelper::SaveStringToFile(CSV, *CSVPath))
+	{
+		UE_LOG(LogTemp, Display, TEXT("[XVInputRecorder] Replay finished, %d frames saved to %s"), FrameMs.Num(), *CSVPath);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Error, TEXT("[XVInputRecorder] Failed to write CSV %s"), *CSVPath);
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("[XVInputRecorder] FrameMs p50=%.2f p95=%.2f p99=%.2f / GameThreadMs p50=%.2f p95=%.2f p99=%.2f"),
+		XVInputRecorder::Percentile(FrameMs, 0.5f), XVInputRecorder::Percentile(FrameMs, 0.95f), XVInputRecorder::Percentile(FrameMs, 0.99f),
+		XVInputRecorder::Percentile(GameThreadMs, 0.5f), XVInputRecorder::Percentile(GameThreadMs, 0.95f), XVInputRecorder::Percentile(GameThreadMs, 0.99f));
+
+	if (bExitOnFinish)
+	{
+		FPlatformMisc::RequestExit(false);
+	}
+}
@@ -1,11 +1,73 @@
 #include "Character/XVPlayerAnimInstance.h"
+#include "Character/XVCharacter.h"
+#include "GameFramework/CharacterMovementComponent.h"
+
+UXVPlayerAnimInstance::UXVPlayerAnimInstance()
+{
+	// 애니메이션 업데이트를 워커 스레드에서 실행
+	bUseMultiThreadedAnimationUpdate = true;
+}
+
+void UXVPlayerAnimInstance::NativeInitializeAnimation()
+{
+	Super::NativeInitializeAnimation();
+
+	Character = Cast<AXVCharacter>(TryGetPawnOwner());
+}
+
+void UXVPlayerAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
+{
+	Super::NativeUpdateAnimation(DeltaSeconds);
+
+	if (!Character)
+	{
+		Character = Cast<AXVCharacter>(TryGetPawnOwner());
+		if (!Character) return;
+	}
+
+	GameThreadData.Velocity = Character->GetVelocity();
+	GameThreadData.ActorRotation = Character->GetActorRotation();
+	GameThreadData.ControlRotation = Character->GetBaseAimRotation();
+	GameThreadData.WeaponType = Character->GetWeapon();
+	GameThreadData.bIsRun = Character->GetISRun();
+	GameThreadData.bIsSit = Character->GetIsSit();
+
+	if (const UCharacterMovementComponent* Movement = Character->GetCharacterMovement())
+	{
+		GameThreadData.Acceleration = Movement->GetCurrentAcceleration();
+		GameThreadData.bIsFalling = Movement->IsFalling();
+	}
+}
+
+void UXVPlayerAnimInstance::NativeThreadSafeUpdateAnimation(float DeltaSeconds)
+{
+	Super::NativeThreadSafeUpdateAnimation(DeltaSeconds);
+
+	const FGameThreadData& Data = GameThreadData;
+
+	State.Velocity = Data.Velocity;
+	State.GroundSpeed = Data.Velocity.Size2D();
+	State.bShouldMove = State.GroundSpeed > MoveSpeedThreshold && !Data.Acceleration.IsNearlyZero();
+	State.bIsFalling = Data.bIsFalling;
+	State.bIsRun = Data.bIsRun;
+	State.bIsSit = Data.bIsSit;
+	State.WeaponType = Data.WeaponType;
+
+	// 액터 기준 로컬 속도로 방향 계산 (UKismetAnimationLibrary::CalculateDirection 과 같은 값)
+	const FVector LocalVelocity = Data.ActorRotation.UnrotateVector(Data.Velocity);
+	State.Direction = State.GroundSpeed > MoveSpeedThreshold ? FMath::RadiansToDegrees(FMath::Atan2(LocalVelocity.Y, LocalVelocity.X)) : 0.f;
+
+	const FRotator AimDelta = (Data.ControlRotation - Data.ActorRotation).GetNormalized();
+	State.AimPitch = AimDelta.Pitch;
+	State.AimYaw = AimDelta.Yaw;
+}
 
 void UXVPlayerAnimInstance::PlayAttackAnim()
 {
 	Montage_Play(AttackAnimMontage);
 }
 
-void UXVPlayerAnimInstance::PlayGunChangeAnim()
+bool UXVPlayerAnimInstance::PlayGunChangeAnim()
 {
-	Montage_Play(ChangeAnimMontage);
+	return Montage_Play(ChangeAnimMontage) > 0.f;
 }
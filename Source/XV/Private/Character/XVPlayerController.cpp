@@ -1,4 +1,5 @@
 #include "Character/XVPlayerController.h"
+#include "Character/XVInputRecorderComponent.h"
 #include "EnhancedInputSubsystems.h"
 
 AXVPlayerController::AXVPlayerController()
@@ -15,6 +16,7 @@ AXVPlayerController::AXVPlayerController()
 	  SubWeaponAction(nullptr),
 	  OpenDoorAction(nullptr)
 {
+	InputRecorder = CreateDefaultSubobject<UXVInputRecorderComponent>(TEXT("InputRecorder"));
 }
 
 void AXVPlayerController::BeginPlay()
@@ -25,7 +27,8 @@ void AXVPlayerController::BeginPlay()
 		// Local Player에서 EnhancedInputLocalPlayerSubsystem을 획득
 		if (UEnhancedInputLocalPlayerSubsystem* Subsystem = LocalPlayer->GetSubsystem<UEnhancedInputLocalPlayerSubsystem>())
 		{
-			if (InputMappingContext)
+			// 녹화 재생 중에는 실제 입력이 섞이지 않도록 매핑을 추가하지 않음
+			if (InputMappingContext && !UXVInputRecorderComponent::IsReplayRequested())
 			{
 				Subsystem->AddMappingContext(InputMappingContext, 0);
 			}
@@ -0,0 +1,17 @@
+#include "Character/XVWeaponSwapNotify.h"
+#include "XV.h"
+#include "Character/XVCharacter.h"
+
+void UXVWeaponSwapNotify::Notify(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
+{
+	XV_SCOPE_CYCLE_COUNTER(STAT_XV_AnimNotify);
+
+	Super::Notify(MeshComp, Animation, EventReference);
+
+	if (!MeshComp) return;
+
+	if (AXVCharacter* Character = Cast<AXVCharacter>(MeshComp->GetOwner()))
+	{
+		Character->ApplyPendingWeaponSlotLayout();
+	}
+}
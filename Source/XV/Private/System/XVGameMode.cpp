@@ -1,9 +1,11 @@
 #include "System/XVGameMode.h"
+#include "XV.h"
 #include "System/XVGameState.h"
 #include "System/XVGameInstance.h"
 #include "World/ElevatorDoor.h"
 #include "Kismet/GameplayStatics.h"
 #include "World/SpawnVolume.h"
+#include "Character/XVInputRecorderComponent.h"
 #include "AI/Character/Base/XVEnemyBase.h"
 #include "GameFramework/PlayerController.h"
 
@@ -44,15 +46,17 @@ void AXVGameMode::StartGame()
 			}
 		}
 	}
-	if (AXVGameState* GS = GetGameState<AXVGameState>())
-	{
-		UE_LOG(LogTemp, Warning, TEXT("Level Starts!"));
-		GS->SpawnedEnemyCount = 0;
-		GS->KilledEnemyCount = 0;
-	}
+	// 스폰/처치 수는 적의 BeginPlay/사망 시 GameState에서 직접 집계
+	UE_LOG(LogTemp, Warning, TEXT("Level Starts!"));
 	
 	SpawnEnemies();
 
+	if (IsProfilingRun())
+	{
+		UE_LOG(LogTemp, Display, TEXT("Profiling run, time limit disabled"));
+		return;
+	}
+
 	if (AXVGameState* GS = GetGameState<AXVGameState>())
 	{
 		GetWorldTimerManager().SetTimer(
@@ -66,6 +70,8 @@ void AXVGameMode::StartGame()
 	
 void AXVGameMode::SpawnEnemies() const
 {
+	XV_SCOPE_CYCLE_COUNTER(STAT_XV_Spawn);
+
 	TArray<AActor*> FoundVolumes;
 	UGameplayStatics::GetAllActorsOfClass(GetWorld(), ASpawnVolume::StaticClass(), FoundVolumes);
 	
@@ -78,11 +84,11 @@ void AXVGameMode::SpawnEnemies() const
 		{
 			if (ASpawnVolume* Volume = Cast<ASpawnVolume>(Actor))
 			{
-				if (!GS->IsWaveTriggered && Volume->ActorHasTag("Patrol"))
+				if (!GS->IsWaveTriggered() && Volume->ActorHasTag("Patrol"))
 				{
 					ValidVolumes.Add(Volume);
 				}
-				else if (GS->IsWaveTriggered && Volume->ActorHasTag("Wave"))
+				else if (GS->IsWaveTriggered() && Volume->ActorHasTag("Wave"))
 				{
 					ValidVolumes.Add(Volume);
 				}
@@ -90,7 +96,7 @@ void AXVGameMode::SpawnEnemies() const
 		}	
 		
 		int32 EnemyToSpawn;
-		if (!GS->IsWaveTriggered) EnemyToSpawn = GS->SpawnPatrolEnemyCount;
+		if (!GS->IsWaveTriggered()) EnemyToSpawn = GS->SpawnPatrolEnemyCount;
 		else EnemyToSpawn = GS->SpawnAllEnemyCount - GS->SpawnPatrolEnemyCount;
 		
 		const int32 SpawnVolumeCount = ValidVolumes.Num();
@@ -100,38 +106,55 @@ void AXVGameMode::SpawnEnemies() const
 			ASpawnVolume* SpawnVolume = ValidVolumes[i % SpawnVolumeCount];
 			if (!SpawnVolume) continue;
 			
-			AActor* SpawnActor = SpawnVolume->SpawnRandomEnemy();
-			if (SpawnActor && SpawnActor->IsA(AXVEnemyBase::StaticClass()))
-			{
-				GS->SpawnedEnemyCount++;
-			}
+			// 스폰된 적은 BeginPlay에서 GameState에 등록됨
+			SpawnVolume->SpawnRandomEnemy();
 		}
 	}
 }
 
-void AXVGameMode::OnEnemyKilled()
+void AXVGameMode::OnEnemyKilled(AXVEnemyBase* KilledEnemy)
 {
-	OnWaveTriggered();
 	if (AXVGameState* GS = GetGameState<AXVGameState>())
 	{
-		GS->KilledEnemyCount++;
-		if (GS->KilledEnemyCount > 0 && GS->KilledEnemyCount >= GS->SpawnedEnemyCount)
-		{
-			GS->CanActiveArrivalPoint = true;
-		}	
+		GS->RecordEnemyKilled(KilledEnemy);
 	}
+
+	OnWaveTriggered();
+	RefreshArrivalPointState();
 }
 
 void AXVGameMode::OnWaveTriggered()
 {
-	
 	if (AXVGameState* GS = GetGameState<AXVGameState>())
 	{
-		GS->CanActiveArrivalPoint = false;
-		if (GS->IsWaveTriggered) return;
+		if (GS->IsWaveTriggered()) return;
 		
-		GS->IsWaveTriggered = true;
-		SpawnEnemies();
+		GS->SetWaveTriggered(true);
+		GS->SetCanActiveArrivalPoint(false);
+
+		// 다음 프레임에 한 번만 스폰
+		if (!bWaveSpawnPending)
+		{
+			bWaveSpawnPending = true;
+			GetWorldTimerManager().SetTimerForNextTick(this, &AXVGameMode::SpawnPendingWave);
+		}
+	}
+}
+
+void AXVGameMode::SpawnPendingWave()
+{
+	bWaveSpawnPending = false;
+
+	SpawnEnemies();
+	RefreshArrivalPointState();
+}
+
+void AXVGameMode::RefreshArrivalPointState() const
+{
+	if (AXVGameState* GS = GetGameState<AXVGameState>())
+	{
+		// 웨이브 스폰 대기 중이면 아직 도착 지점 비활성
+		GS->SetCanActiveArrivalPoint(!bWaveSpawnPending && GS->GetKilledEnemyCount() > 0 && GS->GetAliveEnemyCount() == 0);
 	}
 }
 
@@ -142,6 +165,12 @@ void AXVGameMode::OnTimeLimitExceeded()
 
 void AXVGameMode::EndGame(bool bIsClear)
 {
+	if (IsProfilingRun())
+	{
+		UE_LOG(LogTemp, Display, TEXT("Profiling run, EndGame(%d) ignored"), bIsClear);
+		return;
+	}
+
 	if (APlayerController* PC = UGameplayStatics::GetPlayerController(GetWorld(), 0))
 	{
 		PC->SetPause(true);	
@@ -180,6 +209,8 @@ void AXVGameMode::EndGame(bool bIsClear)
 
 	
 
-
-
-
+bool AXVGameMode::IsProfilingRun()
+{
+	// AI 스트레스 테스트는 게임 모드 없는 자동화 테스트 월드에서 돌기 때문에 입력 재생만 해당
+	return UXVInputRecorderComponent::IsReplayRequested();
+}
@@ -1,14 +1,101 @@
 #include "System/XVGameState.h"
+#include "XV.h"
+#include "AI/Character/Base/XVEnemyBase.h"
+#include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 
 AXVGameState::AXVGameState()
 {
 	TimeLimit = 60.0f;
-	
-	SpawnedEnemyCount = 0;
-	KilledEnemyCount = 0;
 
 	SpawnAllEnemyCount = 10;
 	SpawnPatrolEnemyCount = 3;
-	IsWaveTriggered = false;
-	CanActiveArrivalPoint = true;
+}
+
+void AXVGameState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	// 진행 상태는 바뀐 프레임에만 비교/전송 (Push Model)
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(AXVGameState, Progress, Params);
+}
+
+void AXVGameState::SetWaveTriggered(bool bTriggered)
+{
+	const FXVGameProgress OldProgress = Progress;
+	Progress.bIsWaveTriggered = bTriggered;
+	CommitProgress(OldProgress);
+}
+
+void AXVGameState::SetCanActiveArrivalPoint(bool bCanActive)
+{
+	const FXVGameProgress OldProgress = Progress;
+	Progress.bCanActiveArrivalPoint = bCanActive;
+	CommitProgress(OldProgress);
+}
+
+void AXVGameState::OnRep_Progress(const FXVGameProgress& OldProgress)
+{
+	OnProgressChanged.Broadcast(Progress, OldProgress);
+}
+
+void AXVGameState::CommitProgress(const FXVGameProgress& OldProgress)
+{
+	if (Progress == OldProgress) return;
+
+	MARK_PROPERTY_DIRTY_FROM_NAME(AXVGameState, Progress, this);
+	OnProgressChanged.Broadcast(Progress, OldProgress);
+}
+
+void AXVGameState::RegisterEnemy(AXVEnemyBase* Enemy)
+{
+	if (!Enemy) return;
+
+	bool bAlreadyAlive = false;
+	AliveEnemies.Add(Enemy, &bAlreadyAlive);
+	if (bAlreadyAlive) return;
+
+	SET_DWORD_STAT(STAT_XV_ActiveEnemies, AliveEnemies.Num());
+
+	const FXVGameProgress OldProgress = Progress;
+	Progress.SpawnedEnemyCount++;
+	CommitProgress(OldProgress);
+
+	FXVEnemyTypeCount& TypeCount = EnemyTypeCounts.FindOrAdd(Enemy->GetClass());
+	TypeCount.Spawned++;
+	TypeCount.Alive++;
+}
+
+void AXVGameState::RecordEnemyKilled(AXVEnemyBase* Enemy)
+{
+	if (!Enemy) return;
+
+	// 이미 집계에서 빠진 적은 중복으로 세지 않음
+	if (AliveEnemies.Remove(Enemy) == 0) return;
+
+	SET_DWORD_STAT(STAT_XV_ActiveEnemies, AliveEnemies.Num());
+
+	const FXVGameProgress OldProgress = Progress;
+	Progress.KilledEnemyCount++;
+	CommitProgress(OldProgress);
+
+	FXVEnemyTypeCount& TypeCount = EnemyTypeCounts.FindOrAdd(Enemy->GetClass());
+	TypeCount.Killed++;
+	TypeCount.Alive = FMath::Max(0, TypeCount.Alive - 1);
+}
+
+void AXVGameState::UnregisterEnemy(AXVEnemyBase* Enemy)
+{
+	if (!Enemy) return;
+
+	if (AliveEnemies.Remove(Enemy) == 0) return;
+
+	SET_DWORD_STAT(STAT_XV_ActiveEnemies, AliveEnemies.Num());
+
+	if (FXVEnemyTypeCount* TypeCount = EnemyTypeCounts.Find(Enemy->GetClass()))
+	{
+		TypeCount->Alive = FMath::Max(0, TypeCount->Alive - 1);
+	}
 }
@@ -0,0 +1,121 @@
+#include "System/XVRandomStreamSubsystem.h"
+#include "Character/XVInputRecorderComponent.h"
+#include "NavigationSystem.h"
+#include "Engine/World.h"
+#include "Misc/CommandLine.h"
+
+const FName UXVRandomStreamSubsystem::SpawnDomain(TEXT("Spawn"));
+const FName UXVRandomStreamSubsystem::CombatDomain(TEXT("Combat"));
+const FName UXVRandomStreamSubsystem::NavigationDomain(TEXT("Navigation"));
+
+void UXVRandomStreamSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	int32 CommandLineSeed = 0;
+	if (FParse::Value(FCommandLine::Get(), TEXT("XVSeed="), CommandLineSeed))
+	{
+		Reseed(CommandLineSeed);
+	}
+	else if (UXVInputRecorderComponent::GetReplaySeed(CommandLineSeed))
+	{
+		// 입력 재생 : 게임 모드가 웨이브를 스폰하기 전에 녹화 때 시드로 맞춤
+		Reseed(CommandLineSeed);
+	}
+	else
+	{
+		Reseed(FMath::Rand());
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("[XVRandom] World seed = %d (replay with -XVSeed=%d)"), Seed, Seed);
+}
+
+bool UXVRandomStreamSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UXVRandomStreamSubsystem::Reseed(int32 NewSeed)
+{
+	Seed = NewSeed;
+	Streams.Reset();
+}
+
+FRandomStream& UXVRandomStreamSubsystem::GetStream(FName Domain)
+{
+	if (FRandomStream* Stream = Streams.Find(Domain))
+	{
+		return *Stream;
+	}
+
+	// FName 해시는 실행마다 같지 않을 수 있으므로 문자열 해시 사용
+	const uint32 DomainHash = FCrc::StrCrc32(*Domain.ToString());
+	return Streams.Add(Domain, FRandomStream(static_cast<int32>(HashCombine(static_cast<uint32>(Seed), DomainHash))));
+}
+
+UXVRandomStreamSubsystem* UXVRandomStreamSubsystem::Get(const UObject* WorldContext)
+{
+	const UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UXVRandomStreamSubsystem>() : nullptr;
+}
+
+float UXVRandomStreamSubsystem::FRand(const UObject* WorldContext, FName Domain)
+{
+	UXVRandomStreamSubsystem* Subsystem = Get(WorldContext);
+	return Subsystem ? Subsystem->GetStream(Domain).FRand() : FMath::FRand();
+}
+
+float UXVRandomStreamSubsystem::FRandRange(const UObject* WorldContext, FName Domain, float Min, float Max)
+{
+	UXVRandomStreamSubsystem* Subsystem = Get(WorldContext);
+	return Subsystem ? Subsystem->GetStream(Domain).FRandRange(Min, Max) : FMath::FRandRange(Min, Max);
+}
+
+FRandomStream& UXVRandomStreamSubsystem::GetStream(const UObject* WorldContext, FName Domain)
+{
+	if (UXVRandomStreamSubsystem* Subsystem = Get(WorldContext))
+	{
+		return Subsystem->GetStream(Domain);
+	}
+
+	static FRandomStream FallbackStream(FMath::Rand());
+	return FallbackStream;
+}
+
+bool UXVRandomStreamSubsystem::GetRandomNavPointInRadius(const UObject* WorldContext, FName Domain, const FVector& Origin, float Radius, FVector& OutPoint, int32 MaxAttempts)
+{
+	UXVRandomStreamSubsystem* Subsystem = Get(WorldContext);
+	UNavigationSystemV1* NavSys = UNavigationSystemV1::GetCurrent<UNavigationSystemV1>(WorldContext);
+	if (!NavSys) return false;
+
+	// 서브시스템이 없으면 기존 엔진 함수 사용
+	if (!Subsystem)
+	{
+		FNavLocation NavLocation;
+		if (NavSys->GetRandomReachablePointInRadius(Origin, Radius, NavLocation))
+		{
+			OutPoint = NavLocation.Location;
+			return true;
+		}
+		return false;
+	}
+
+	FRandomStream& Stream = Subsystem->GetStream(Domain);
+	const FVector ProjectExtent(Radius * 0.25f, Radius * 0.25f, 500.f);
+
+	for (int32 Attempt = 0; Attempt < MaxAttempts; ++Attempt)
+	{
+		// 원 안에 균일 분포 (반지름에 sqrt)
+		const float Angle = Stream.FRandRange(0.f, UE_TWO_PI);
+		const float Distance = Radius * FMath::Sqrt(Stream.FRand());
+		const FVector Candidate = Origin + FVector(FMath::Cos(Angle) * Distance, FMath::Sin(Angle) * Distance, 0.f);
+
+		FNavLocation NavLocation;
+		if (NavSys->ProjectPointToNavigation(Candidate, NavLocation, ProjectExtent))
+		{
+			OutPoint = NavLocation.Location;
+			return true;
+		}
+	}
+	return false;
+}
@@ -0,0 +1,403 @@
+#include "System/XVWeaponEffectsSubsystem.h"
+#include "XV.h"
+#include "NiagaraComponent.h"
+#include "NiagaraSystem.h"
+#include "NiagaraDataChannel.h"
+#include "NiagaraDataChannelAccessor.h"
+#include "Kismet/GameplayStatics.h"
+#include "DrawDebugHelpers.h"
+#include "HAL/IConsoleManager.h"
+#include "Camera/PlayerCameraManager.h"
+#include "GameFramework/PlayerController.h"
+
+static TAutoConsoleVariable<bool> CVarXVWeaponDebugDraw(
+	TEXT("XV.Weapon.DebugDraw"),
+	true,
+	TEXT("무기 발사 디버그 라인/히트 표시"));
+
+static TAutoConsoleVariable<float> CVarXVWeaponSoundMergeDistance(
+	TEXT("XV.Weapon.SoundMergeDistance"),
+	100.f,
+	TEXT("같은 프레임에 이 거리 안에서 요청된 같은 사운드는 한 번만 재생"));
+
+static TAutoConsoleVariable<float> CVarXVFXImpactCullDistance(
+	TEXT("XV.FX.ImpactCullDistance"),
+	5000.f,
+	TEXT("등록되지 않은 피격 이펙트의 거리 컬링 기준 (0 이면 컬링 X)"));
+
+static TAutoConsoleVariable<float> CVarXVFXViewCullMargin(
+	TEXT("XV.FX.ViewCullMargin"),
+	15.f,
+	TEXT("시야 컬링 시 카메라 FOV 에 더하는 여유 각도 (도)"));
+
+static TAutoConsoleVariable<float> CVarXVFXNearRadius(
+	TEXT("XV.FX.NearRadius"),
+	500.f,
+	TEXT("카메라에서 이 거리 안의 이펙트는 시야 밖이어도 스폰"));
+
+// === 풀 ==========================================================================================================//
+#pragma region Pool
+
+void UXVWeaponEffectsSubsystem::RegisterEffect(UNiagaraSystem* System, const FXVEffectSettings& Settings)
+{
+	if (!System) return;
+
+	FXVEffectPool& Pool = FindOrAddPool(System);
+	Pool.Settings = Settings;
+
+	const int32 NumToCreate = Settings.PrewarmCount - (Pool.FreeComponents.Num() + Pool.ActiveComponents.Num());
+	Pool.FreeComponents.Reserve(Pool.FreeComponents.Num() + FMath::Max(NumToCreate, 0));
+	for (int32 i = 0; i < NumToCreate; i++)
+	{
+		if (UNiagaraComponent* Component = CreatePooledComponent(System))
+		{
+			Pool.FreeComponents.Add(Component);
+		}
+	}
+}
+
+FXVEffectPool& UXVWeaponEffectsSubsystem::FindOrAddPool(UNiagaraSystem* System)
+{
+	return Pools.FindOrAdd(System);
+}
+
+UNiagaraComponent* UXVWeaponEffectsSubsystem::CreatePooledComponent(UNiagaraSystem* System)
+{
+	UWorld* World = GetWorld();
+	if (!World) return nullptr;
+
+	UNiagaraComponent* Component = NewObject<UNiagaraComponent>(World);
+	Component->SetAsset(System);
+	Component->bAutoActivate = false;
+	Component->SetAutoDestroy(false);
+	Component->OnSystemFinished.AddUniqueDynamic(this, &UXVWeaponEffectsSubsystem::OnPooledSystemFinished);
+	Component->RegisterComponentWithWorld(World);
+	return Component;
+}
+
+UNiagaraComponent* UXVWeaponEffectsSubsystem::AcquireComponent(UNiagaraSystem* System)
+{
+	FXVEffectPool& Pool = FindOrAddPool(System);
+
+	UNiagaraComponent* Component = nullptr;
+
+	// 동시 재생 수 제한
+	if (Pool.ActiveComponents.Num() >= Pool.Settings.MaxConcurrent)
+	{
+		if (!Pool.Settings.bStealOldest) return nullptr;
+
+		// 목록에서 먼저 빼고 정지해야 완료 콜백에서 다시 풀로 들어가지 않음
+		Component = Pool.ActiveComponents[0];
+		Pool.ActiveComponents.RemoveAt(0, 1, EAllowShrinking::No);
+		if (IsValid(Component))
+		{
+			Component->DeactivateImmediate();
+			// 이전 총구에 붙은 채로 재사용되면 월드 위치 이펙트가 무기를 따라다님
+			Component->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+		}
+		else
+		{
+			Component = nullptr;
+		}
+	}
+
+	while (!Component && Pool.FreeComponents.Num() > 0)
+	{
+		Component = Pool.FreeComponents.Pop(EAllowShrinking::No);
+		if (!IsValid(Component))
+		{
+			Component = nullptr;
+		}
+	}
+
+	if (!Component)
+	{
+		Component = CreatePooledComponent(System);
+	}
+
+	if (Component)
+	{
+		Pool.ActiveComponents.Add(Component);
+	}
+	return Component;
+}
+
+void UXVWeaponEffectsSubsystem::OnPooledSystemFinished(UNiagaraComponent* Component)
+{
+	if (!Component) return;
+
+	FXVEffectPool* Pool = Pools.Find(Component->GetAsset());
+	if (!Pool || Pool->ActiveComponents.Remove(Component) == 0) return;
+
+	// 붙어 있던 무기가 교체되어 파괴돼도 영향이 없도록 떼어 둠
+	Component->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+	Pool->FreeComponents.Add(Component);
+}
+
+void UXVWeaponEffectsSubsystem::Deinitialize()
+{
+	for (TPair<TObjectPtr<UNiagaraSystem>, FXVEffectPool>& Pair : Pools)
+	{
+		for (UNiagaraComponent* Component : Pair.Value.FreeComponents)
+		{
+			if (IsValid(Component)) Component->DestroyComponent();
+		}
+		for (UNiagaraComponent* Component : Pair.Value.ActiveComponents)
+		{
+			if (IsValid(Component)) Component->DestroyComponent();
+		}
+	}
+	Pools.Empty();
+
+	Super::Deinitialize();
+}
+
+#pragma endregion
+
+// === 요청 ========================================================================================================//
+#pragma region Queue
+
+void UXVWeaponEffectsSubsystem::QueueNiagara(UNiagaraSystem* System, USceneComponent* AttachTo, FName SocketName, const FTransform& Transform)
+{
+	if (!System) return;
+
+	FXVQueuedNiagaraEffect& Effect = PendingNiagara.AddDefaulted_GetRef();
+	Effect.System = System;
+	Effect.AttachTo = AttachTo;
+	Effect.SocketName = SocketName;
+	Effect.Transform = Transform;
+}
+
+void UXVWeaponEffectsSubsystem::QueueImpact(UNiagaraDataChannelAsset* DataChannel, UNiagaraSystem* FallbackSystem, const FVector& Location, const FVector& Normal)
+{
+	if (!DataChannel && !FallbackSystem) return;
+
+	PendingImpacts.Add({ DataChannel, FallbackSystem, Location, Normal });
+}
+
+void UXVWeaponEffectsSubsystem::QueueSound(USoundBase* Sound, const FVector& Location)
+{
+	if (!Sound) return;
+
+	PendingSounds.Add({ Sound, Location });
+}
+
+void UXVWeaponEffectsSubsystem::QueueDebugShot(const FVector& Start, const FVector& End, bool bHit, AActor* HitActor, float Duration)
+{
+#if ENABLE_DRAW_DEBUG
+	if (!CVarXVWeaponDebugDraw.GetValueOnGameThread()) return;
+
+	FXVQueuedDebugShot& Shot = PendingDebugShots.AddDefaulted_GetRef();
+	Shot.Start = Start;
+	Shot.End = End;
+	Shot.HitActor = HitActor;
+	Shot.Duration = Duration;
+	Shot.bHit = bHit;
+#endif
+}
+
+#pragma endregion
+
+// === 처리 ========================================================================================================//
+#pragma region Flush
+
+void UXVWeaponEffectsSubsystem::Tick(float DeltaTime)
+{
+	XV_SCOPE_CYCLE_COUNTER(STAT_XV_WeaponFire);
+
+	Super::Tick(DeltaTime);
+
+	if (!PendingNiagara.IsEmpty() || !PendingImpacts.IsEmpty())
+	{
+		GatherViews();
+	}
+
+	FlushNiagara();
+	FlushImpacts();
+	FlushSounds();
+	FlushDebugShots();
+}
+
+TStatId UXVWeaponEffectsSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UXVWeaponEffectsSubsystem, STATGROUP_Tickables);
+}
+
+bool UXVWeaponEffectsSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UXVWeaponEffectsSubsystem::GatherViews()
+{
+	Views.Reset();
+
+	const float Margin = CVarXVFXViewCullMargin.GetValueOnGameThread();
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		if (!PlayerController || !PlayerController->IsLocalController() || !PlayerController->PlayerCameraManager) continue;
+
+		const APlayerCameraManager* Camera = PlayerController->PlayerCameraManager;
+		FXVEffectView& View = Views.AddDefaulted_GetRef();
+		View.Location = Camera->GetCameraLocation();
+		View.Forward = Camera->GetCameraRotation().Vector();
+		View.CosHalfFOV = FMath::Cos(FMath::DegreesToRadians(FMath::Min(Camera->GetFOVAngle() * 0.5f + Margin, 180.f)));
+	}
+}
+
+bool UXVWeaponEffectsSubsystem::IsCulled(const FVector& Location, const FXVEffectSettings& Settings) const
+{
+	// 로컬 카메라가 없으면 (데디케이티드 서버) 볼 사람이 없음
+	if (Views.IsEmpty()) return true;
+
+	const float NearRadiusSq = FMath::Square(CVarXVFXNearRadius.GetValueOnGameThread());
+	const float CullDistanceSq = FMath::Square(Settings.CullDistance);
+	for (const FXVEffectView& View : Views)
+	{
+		const FVector ToEffect = Location - View.Location;
+		const float DistSq = ToEffect.SizeSquared();
+		if (Settings.CullDistance > 0.f && DistSq > CullDistanceSq) continue;
+		if (!Settings.bCullOutsideView || DistSq <= NearRadiusSq) return false;
+		if ((ToEffect.GetSafeNormal() | View.Forward) >= View.CosHalfFOV) return false;
+	}
+	return true;
+}
+
+void UXVWeaponEffectsSubsystem::FlushNiagara()
+{
+	if (PendingNiagara.IsEmpty()) return;
+
+	for (const FXVQueuedNiagaraEffect& Effect : PendingNiagara)
+	{
+		const FXVEffectPool& Pool = FindOrAddPool(Effect.System);
+		if (IsCulled(Effect.Transform.GetLocation(), Pool.Settings)) continue;
+
+		UNiagaraComponent* Component = AcquireComponent(Effect.System);
+		if (!Component) continue;
+
+		if (USceneComponent* AttachTo = Effect.AttachTo.Get())
+		{
+			Component->AttachToComponent(AttachTo, FAttachmentTransformRules::SnapToTargetNotIncludingScale, Effect.SocketName);
+		}
+		else
+		{
+			Component->SetWorldLocationAndRotation(Effect.Transform.GetLocation(), Effect.Transform.GetRotation());
+		}
+		Component->Activate(true);
+	}
+	PendingNiagara.Reset();
+}
+
+void UXVWeaponEffectsSubsystem::FlushImpacts()
+{
+	if (PendingImpacts.IsEmpty()) return;
+
+	static const FName PositionName(TEXT("Position"));
+	static const FName NormalName(TEXT("Normal"));
+
+	FXVEffectSettings DefaultSettings;
+	DefaultSettings.CullDistance = CVarXVFXImpactCullDistance.GetValueOnGameThread();
+
+	// 컬링된 요청 제거 (등록된 풀백 이펙트가 있으면 그 설정 사용)
+	PendingImpacts.RemoveAllSwap([this, &DefaultSettings](const FXVQueuedImpact& Impact)
+	{
+		const FXVEffectPool* Pool = Impact.FallbackSystem ? Pools.Find(Impact.FallbackSystem) : nullptr;
+		return IsCulled(Impact.Location, Pool ? Pool->Settings : DefaultSettings);
+	}, EAllowShrinking::No);
+
+	// 같은 채널끼리 모아서 채널당 한 번만 기록
+	PendingImpacts.Sort([](const FXVQueuedImpact& A, const FXVQueuedImpact& B) { return A.DataChannel < B.DataChannel; });
+
+	UWorld* World = GetWorld();
+	for (int32 Start = 0; Start < PendingImpacts.Num();)
+	{
+		UNiagaraDataChannelAsset* DataChannel = PendingImpacts[Start].DataChannel;
+		int32 End = Start + 1;
+		while (End < PendingImpacts.Num() && PendingImpacts[End].DataChannel == DataChannel)
+		{
+			End++;
+		}
+
+		if (DataChannel)
+		{
+			FNiagaraDataChannelSearchParameters SearchParams;
+			SearchParams.Location = PendingImpacts[Start].Location;
+			if (UNiagaraDataChannelWriter* Writer = UNiagaraDataChannelLibrary::WriteToNiagaraDataChannel(
+				World, DataChannel, SearchParams, End - Start, false, true, true, TEXT("XVWeaponImpacts")))
+			{
+				for (int32 i = Start; i < End; i++)
+				{
+					Writer->WritePosition(PositionName, i - Start, PendingImpacts[i].Location);
+					Writer->WriteVector(NormalName, i - Start, PendingImpacts[i].Normal);
+				}
+			}
+		}
+		else
+		{
+			// 채널이 없는 무기는 풀에서 하나씩 스폰
+			for (int32 i = Start; i < End; i++)
+			{
+				const FXVQueuedImpact& Impact = PendingImpacts[i];
+				if (UNiagaraComponent* Component = AcquireComponent(Impact.FallbackSystem))
+				{
+					Component->SetWorldLocationAndRotation(Impact.Location, Impact.Normal.Rotation());
+					Component->Activate(true);
+				}
+			}
+		}
+
+		Start = End;
+	}
+	PendingImpacts.Reset();
+}
+
+void UXVWeaponEffectsSubsystem::FlushSounds()
+{
+	if (PendingSounds.IsEmpty()) return;
+
+	const float MergeDistanceSq = FMath::Square(CVarXVWeaponSoundMergeDistance.GetValueOnGameThread());
+	for (int32 i = 0; i < PendingSounds.Num(); i++)
+	{
+		const FXVQueuedSound& Sound = PendingSounds[i];
+
+		// 앞에서 이미 재생한 같은 사운드와 가까우면 생략
+		bool bMerged = false;
+		for (int32 j = 0; j < i && !bMerged; j++)
+		{
+			bMerged = PendingSounds[j].Sound == Sound.Sound && FVector::DistSquared(PendingSounds[j].Location, Sound.Location) <= MergeDistanceSq;
+		}
+
+		if (!bMerged)
+		{
+			UGameplayStatics::PlaySoundAtLocation(this, Sound.Sound, Sound.Location);
+		}
+	}
+	PendingSounds.Reset();
+}
+
+void UXVWeaponEffectsSubsystem::FlushDebugShots()
+{
+#if ENABLE_DRAW_DEBUG
+	if (PendingDebugShots.IsEmpty()) return;
+
+	UWorld* World = GetWorld();
+	for (const FXVQueuedDebugShot& Shot : PendingDebugShots)
+	{
+		DrawDebugLine(World, Shot.Start, Shot.End, FColor::Red, false, Shot.Duration, 0, 2.0f);
+
+		if (Shot.bHit)
+		{
+			DrawDebugSphere(World, Shot.End, 10.0f, 12, FColor::Green, false, Shot.Duration);
+
+			if (GEngine && Shot.HitActor.IsValid())
+			{
+				GEngine->AddOnScreenDebugMessage(-1, Shot.Duration, FColor::Yellow, FString::Printf(TEXT("Hit: %s"), *Shot.HitActor->GetName()));
+			}
+		}
+	}
+	PendingDebugShots.Reset();
+#endif
+}
+
+#pragma endregion
@@ -1,6 +1,7 @@
 #include "TestGun.h"
-#include "DrawDebugHelpers.h"
-#include "Kismet/GameplayStatics.h"
+#include "XV.h"
+#include "System/XVRandomStreamSubsystem.h"
+#include "System/XVWeaponEffectsSubsystem.h"
 
 ATestGun::ATestGun()
 {
@@ -12,12 +13,29 @@ ATestGun::ATestGun()
     DebugDrawDuration = 1.0f;
     DebugLineLength = 5000.0f;
     MuzzleSocketName = TEXT("MuzzleSocket");
+    MuzzleFlashNiagara = nullptr;
+    ImpactDataChannel = nullptr;
+    ImpactNiagara = nullptr;
+    ShotGunPelletCount = 8;
+    ShotGunSpreadAngle = 6.0f;
 }
 
 void ATestGun::BeginPlay()
 {
     Super::BeginPlay();
 
+    // 이펙트 풀 미리 생성
+    if (UXVWeaponEffectsSubsystem* Effects = GetWorld()->GetSubsystem<UXVWeaponEffectsSubsystem>())
+    {
+        Effects->RegisterEffect(MuzzleFlashNiagara, MuzzleFlashSettings);
+        Effects->RegisterEffect(ImpactNiagara, ImpactSettings);
+    }
+
+    StartAutoFire();
+}
+
+void ATestGun::StartAutoFire()
+{
     // 자동 발사 시작
     if (bAutoFire)
     {
@@ -33,113 +51,60 @@ void ATestGun::BeginPlay()
 
 void ATestGun::FireBullet()
 {
-    // 총구 위치와 회전 계산
-    FVector MuzzleLocation;
-    FRotator MuzzleRotation;
-    
-    if (GunMesh->DoesSocketExist(MuzzleSocketName))
+    // 발사 스탯은 진입점(AXVCharacter::Fire, 자동 발사 타이머)에서 기록
+    TRACE_CPUPROFILER_EVENT_SCOPE(ATestGun::FireBullet);
+
+    // 총구 트랜스폼 (소켓이 없으면 액터 기준)
+    FTransform MuzzleTransform;
+    const bool bHasMuzzleSocket = MuzzleSocketCache.GetSocketTransform(GunMesh, MuzzleSocketName, MuzzleTransform);
+    const FVector MuzzleLocation = MuzzleTransform.GetLocation();
+    const FVector MuzzleForward = MuzzleTransform.GetUnitAxis(EAxis::X);
+
+    // 탄 방향 (AI 와 같은 퍼짐 모델, 산탄총이면 여러 발)
+    // 행에 퍼짐 설정이 없으면 예전 동작 유지: 산탄총은 고정 반각, 그 외는 퍼짐/반동 없음
+    int32 NumPellets = 1;
+    float HalfAngle = 0.f;
+    if (WeaponStat.bUseSpread)
     {
-        MuzzleLocation = GunMesh->GetSocketLocation(MuzzleSocketName);
-        MuzzleRotation = GunMesh->GetSocketRotation(MuzzleSocketName);
+        NumPellets = WeaponStat.Spread.PelletCount;
+        HalfAngle = FXVSpreadModel::ConsumeShot(WeaponStat.Spread, SpreadState, GetWorld()->GetTimeSeconds());
     }
-    else
+    else if (CurrentWeaponType == EWeaponType::ShotGun)
     {
-        MuzzleLocation = GetActorLocation();
-        MuzzleRotation = GetActorRotation();
+        NumPellets = FMath::Max(ShotGunPelletCount, 1);
+        HalfAngle = ShotGunSpreadAngle;
     }
+    TArray<FVector, TInlineAllocator<16>> Directions;
+    FXVSpreadModel::EvaluatePellets(MuzzleForward, HalfAngle, NumPellets,
+        UXVRandomStreamSubsystem::GetStream(this, UXVRandomStreamSubsystem::CombatDomain), Directions);
 
-    // Z축 방향 반전 (180도)
-    FVector DownVector = MuzzleRotation.RotateVector(FVector::ForwardVector);
-    FVector EndLocation = MuzzleLocation + (DownVector * DebugLineLength);
-
-    // 라인 트레이스 설정
-    FHitResult Hit;
-    FCollisionQueryParams QueryParams;
-    QueryParams.AddIgnoredActor(this);
-
-    // 라인 트레이스 실행
-    bool bHit = GetWorld()->LineTraceSingleByChannel(
-        Hit,
-        MuzzleLocation,
-        EndLocation,
-        ECC_Visibility,
-        QueryParams
-    );
-
-    // 머즐 플래시 이펙트 재생
-    if (MuzzleFlashNiagara)
-    {
-        if (GunMesh->DoesSocketExist(MuzzleSocketName))
-        {
-            UNiagaraFunctionLibrary::SpawnSystemAttached(
-                MuzzleFlashNiagara,
-                GunMesh,
-                MuzzleSocketName,
-                FVector::ZeroVector,
-                FRotator::ZeroRotator,
-                EAttachLocation::SnapToTarget,
-                true
-            );
-        }
-        else
-        {
-            UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-                GetWorld(),
-                MuzzleFlashNiagara,
-                MuzzleLocation,
-                MuzzleRotation
-            );
-        }
-    }
+    // 라인 트레이스 (모든 탄이 같은 쿼리 파라미터 사용)
+    static const FName FireTraceTag(TEXT("XVFireBullet"));
+    FCollisionQueryParams QueryParams(FireTraceTag, false, this);
+    TArray<FHitResult, TInlineAllocator<16>> Hits;
+    FXVHitScan::TraceBatch(GetWorld(), MuzzleLocation, Directions, DebugLineLength, ECC_Visibility, QueryParams, Hits);
 
-    // 발사 사운드 재생
-    if (FireSound)
-    {
-        UGameplayStatics::PlaySoundAtLocation(
-            this,
-            FireSound,
-            MuzzleLocation,
-            1.0f,
-            1.0f,
-            0.0f
-        );
-    }
+    // 연출은 프레임 끝에 모아서 처리 (머즐 플래시/사운드는 발사당 한 번)
+    UXVWeaponEffectsSubsystem* Effects = GetWorld()->GetSubsystem<UXVWeaponEffectsSubsystem>();
+    if (!Effects) return;
 
-    // 디버그 라인 그리기
-    DrawDebugLine(
-        GetWorld(),
-        MuzzleLocation,
-        bHit ? Hit.ImpactPoint : EndLocation,
-        FColor::Red,
-        false,
-        DebugDrawDuration,
-        0,
-        2.0f
-    );
-
-    // 히트 결과 표시
-    if (bHit)
-    {
-        DrawDebugSphere(
-            GetWorld(),
-            Hit.ImpactPoint,
-            10.0f,
-            12,
-            FColor::Green,
-            false,
-            DebugDrawDuration
-        );
+    Effects->QueueNiagara(MuzzleFlashNiagara, bHasMuzzleSocket ? GunMesh : nullptr, MuzzleSocketName, MuzzleTransform);
+    Effects->QueueSound(FireSound, MuzzleLocation);
 
-        if (Hit.GetActor())
+    for (const FHitResult& Hit : Hits)
+    {
+        if (Hit.bBlockingHit)
         {
-            FString HitMessage = FString::Printf(TEXT("Hit: %s"), *Hit.GetActor()->GetName());
-            GEngine->AddOnScreenDebugMessage(-1, DebugDrawDuration, FColor::Yellow, HitMessage);
+            Effects->QueueImpact(ImpactDataChannel, ImpactNiagara, Hit.ImpactPoint, Hit.ImpactNormal);
         }
+        Effects->QueueDebugShot(MuzzleLocation, Hit.bBlockingHit ? Hit.ImpactPoint : Hit.TraceEnd, Hit.bBlockingHit, Hit.GetActor(), DebugDrawDuration);
     }
 }
 
 void ATestGun::AutoFireTimerCallback()
 {
+    XV_SCOPE_CYCLE_COUNTER(STAT_XV_WeaponFire);
+
     FireBullet();
 }
 
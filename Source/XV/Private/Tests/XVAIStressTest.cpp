@@ -0,0 +1,206 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Tests/XVTestWorld.h"
+#include "XV.h"
+#include "World/SpawnVolume.h"
+#include "Data/EnemySpawnRow.h"
+#include "AI/Character/Melee/XVEnemyMelee.h"
+#include "AI/Character/Ranged/XVEnemyRanged.h"
+#include "AI/System/Spatial/XVEnemySpatialGridSubsystem.h"
+#include "Components/BoxComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "CoreGlobals.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace XVAIStressTest
+{
+	// 초당 1회 기록하는 샘플
+	struct FSample
+	{
+		double Time = 0.0;
+		int32 NumEnemies = 0;
+		float GameThreadMs = 0.f;
+		float AITickMs = 0.f;
+		int32 NavQueries = 0;
+		float UsedPhysicalMB = 0.f;
+	};
+
+	// 실행 옵션 (커맨드라인으로 덮어씀)
+	struct FOptions
+	{
+		int32 NumMelee = 50;
+		int32 NumRanged = 50;
+		float Duration = 60.f;
+		float FPS = 30.f;
+		FString VolumeClassPath = TEXT("/Game/System/Blueprints/BP_WaveEnemySpawnVolume.BP_WaveEnemySpawnVolume_C");
+		FString MeleeClassPath;
+		FString RangedClassPath;
+		FString CSVPath;
+
+		FOptions()
+		{
+			const TCHAR* CommandLine = FCommandLine::Get();
+			FParse::Value(CommandLine, TEXT("XVStressMelee="), NumMelee);
+			FParse::Value(CommandLine, TEXT("XVStressRanged="), NumRanged);
+			FParse::Value(CommandLine, TEXT("XVStressDuration="), Duration);
+			FParse::Value(CommandLine, TEXT("XVStressFPS="), FPS);
+			FParse::Value(CommandLine, TEXT("XVStressVolumeClass="), VolumeClassPath);
+			FParse::Value(CommandLine, TEXT("XVStressMeleeClass="), MeleeClassPath);
+			FParse::Value(CommandLine, TEXT("XVStressRangedClass="), RangedClassPath);
+			if (!FParse::Value(CommandLine, TEXT("XVStressCSV="), CSVPath))
+			{
+				CSVPath = FPaths::ProjectSavedDir() / TEXT("Profiling") / FString::Printf(TEXT("XVStress_%s.csv"), *FDateTime::Now().ToString());
+			}
+			FPS = FMath::Max(FPS, 1.f);
+		}
+	};
+
+	// 적이 떨어지지 않도록 바닥 하나만 있는 테스트 레벨 생성
+	static void BuildTestLevel(UWorld* World, float HalfExtent)
+	{
+		UStaticMesh* Cube = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+		AStaticMeshActor* Floor = World->SpawnActor<AStaticMeshActor>(FVector(0.f, 0.f, -50.f), FRotator::ZeroRotator);
+		if (!Floor || !Cube) return;
+
+		UStaticMeshComponent* FloorMesh = Floor->GetStaticMeshComponent();
+		FloorMesh->SetMobility(EComponentMobility::Movable);
+		FloorMesh->SetStaticMesh(Cube);
+		Floor->SetActorScale3D(FVector(HalfExtent / 50.f, HalfExtent / 50.f, 1.f));
+	}
+
+	// 스폰 볼륨 데이터 테이블에서 해당 타입(근접/원거리)의 적 클래스 검색
+	static TSubclassOf<AActor> FindEnemyClass(const ASpawnVolume* Volume, UClass* BaseClass, const FString& OverridePath)
+	{
+		if (!OverridePath.IsEmpty())
+		{
+			return LoadClass<AActor>(nullptr, *OverridePath);
+		}
+		if (!Volume || !Volume->EnemyDataTable) return nullptr;
+
+		static const FString ContextString(TEXT("XVStressTest"));
+		TArray<FEnemySpawnRow*> Rows;
+		Volume->EnemyDataTable->GetAllRows(ContextString, Rows);
+		for (const FEnemySpawnRow* Row : Rows)
+		{
+			if (Row && Row->EnemyClass && Row->EnemyClass->IsChildOf(BaseClass))
+			{
+				return Row->EnemyClass;
+			}
+		}
+		return nullptr;
+	}
+}
+
+// 빈 테스트 월드(바닥만 생성)에 ASpawnVolume 으로 근접/원거리 적을 스폰하고
+// 고정 스텝으로 월드를 돌리면서 초당 게임 스레드/AI 시간/길찾기 요청 수/메모리를 CSV 로 기록
+// 테스트 레벨에 내비 메시는 없음 (길찾기 요청 수는 그대로 세지만 경로 탐색 비용은 포함되지 않음)
+// 예) UnrealEditor-Cmd XV.uproject -nullrhi -unattended -ExecCmds="Automation RunTests XV.AI.StressTest; Quit"
+//     [-XVStressMelee=200 -XVStressRanged=100 -XVStressDuration=60 -XVStressFPS=30 -XVStressCSV=경로]
+//     [-XVStressVolumeClass=... -XVStressMeleeClass=/Game/.../BP_Melee.BP_Melee_C -XVStressRangedClass=...]
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FXVAIStressTest, "XV.AI.StressTest",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FXVAIStressTest::RunTest(const FString& Parameters)
+{
+	using namespace XVAIStressTest;
+
+	const FOptions Options;
+	constexpr float HalfExtent = 20000.f;
+	constexpr float SpawnHalfExtent = 3000.f;
+
+	FXVTestWorld TestWorld;
+	UWorld* World = TestWorld.Get();
+	BuildTestLevel(World, HalfExtent);
+	TestWorld.BeginPlay();
+
+	// 스폰 볼륨 (블루프린트가 없으면 C++ 기본 클래스, 이때는 적 클래스 경로 필요)
+	UClass* VolumeClass = LoadClass<ASpawnVolume>(nullptr, *Options.VolumeClassPath);
+	ASpawnVolume* Volume = World->SpawnActor<ASpawnVolume>(VolumeClass ? VolumeClass : ASpawnVolume::StaticClass(), FVector(0.f, 0.f, 120.f), FRotator::ZeroRotator);
+	if (!TestNotNull(TEXT("Spawn volume"), Volume)) return false;
+	Volume->SpawningBox->SetBoxExtent(FVector(SpawnHalfExtent, SpawnHalfExtent, 0.f));
+
+	const TSubclassOf<AActor> MeleeClass = FindEnemyClass(Volume, AXVEnemyMelee::StaticClass(), Options.MeleeClassPath);
+	const TSubclassOf<AActor> RangedClass = FindEnemyClass(Volume, AXVEnemyRanged::StaticClass(), Options.RangedClassPath);
+	if (!TestTrue(FString::Printf(TEXT("Enemy classes found (Melee=%s, Ranged=%s)"), *GetNameSafe(MeleeClass), *GetNameSafe(RangedClass)), MeleeClass && RangedClass))
+	{
+		return false;
+	}
+
+	int32 NumSpawned = 0;
+	const int32 Total = Options.NumMelee + Options.NumRanged;
+	for (int32 i = 0; i < Total; i++)
+	{
+		NumSpawned += Volume->SpawnEnemyInBox(i < Options.NumMelee ? MeleeClass : RangedClass) ? 1 : 0;
+	}
+	TestEqual(TEXT("Spawned enemies"), NumSpawned, Total);
+
+	const UXVEnemySpatialGridSubsystem* SpatialGrid = World->GetSubsystem<UXVEnemySpatialGridSubsystem>();
+
+	// 고정 스텝으로 월드 틱 (게임 스레드 시간 = World->Tick 실제 시간)
+	const float DeltaTime = 1.f / Options.FPS;
+	const int32 NumFrames = FMath::CeilToInt(Options.Duration * Options.FPS);
+	const int32 FramesPerSample = FMath::Max(FMath::RoundToInt(Options.FPS), 1);
+
+	TArray<FSample> Samples;
+	Samples.Reserve(NumFrames / FramesPerSample + 1);
+	float AccumulatedGameThreadMs = 0.f;
+	int32 FramesSinceSample = 0;
+
+	FXVStressCounters::Reset();
+	FXVStressCounters::bEnabled = true;
+
+	for (int32 Frame = 1; Frame <= NumFrames; Frame++)
+	{
+		const double FrameStart = FPlatformTime::Seconds();
+		World->Tick(LEVELTICK_All, DeltaTime);
+		AccumulatedGameThreadMs += static_cast<float>((FPlatformTime::Seconds() - FrameStart) * 1000.0);
+		++GFrameCounter;
+
+		if (++FramesSinceSample < FramesPerSample && Frame < NumFrames) continue;
+
+		FSample& Sample = Samples.AddDefaulted_GetRef();
+		Sample.Time = Frame * DeltaTime;
+		Sample.NumEnemies = SpatialGrid ? SpatialGrid->GetNumEnemies() : 0;
+		Sample.GameThreadMs = AccumulatedGameThreadMs / FramesSinceSample;
+		Sample.AITickMs = static_cast<float>(FPlatformTime::ToMilliseconds64(FXVStressCounters::AITickCycles) / FramesSinceSample);
+		Sample.NavQueries = FXVStressCounters::NavQueries;
+		Sample.UsedPhysicalMB = static_cast<float>(FPlatformMemory::GetStats().UsedPhysical) / (1024.f * 1024.f);
+
+		FXVStressCounters::Reset();
+		AccumulatedGameThreadMs = 0.f;
+		FramesSinceSample = 0;
+	}
+
+	FXVStressCounters::bEnabled = false;
+
+	FString CSV = TEXT("Time,NumEnemies,GameThreadMs,AITickMs,NavQueries,UsedPhysicalMB\n");
+	float TotalGameThreadMs = 0.f;
+	float TotalAITickMs = 0.f;
+	for (const FSample& Sample : Samples)
+	{
+		CSV += FString::Printf(TEXT("%.2f,%d,%.3f,%.3f,%d,%.1f\n"),
+			Sample.Time, Sample.NumEnemies, Sample.GameThreadMs, Sample.AITickMs, Sample.NavQueries, Sample.UsedPhysicalMB);
+		TotalGameThreadMs += Sample.GameThreadMs;
+		TotalAITickMs += Sample.AITickMs;
+	}
+
+	TestTrue(FString::Printf(TEXT("CSV saved to %s"), *Options.CSVPath), FFileHelper::SaveStringToFile(CSV, *Options.CSVPath));
+
+	if (Samples.Num() > 0)
+	{
+		AddInfo(FString::Printf(TEXT("Melee=%d Ranged=%d %.0fs @ %.0ffps | GameThread avg %.3fms | AI avg %.3fms | CSV %s"),
+			Options.NumMelee, Options.NumRanged, Options.Duration, Options.FPS,
+			TotalGameThreadMs / Samples.Num(), TotalAITickMs / Samples.Num(), *Options.CSVPath));
+	}
+	return true;
+}
+
+#endif
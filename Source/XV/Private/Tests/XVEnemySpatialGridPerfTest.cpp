@@ -0,0 +1,114 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Tests/XVTestWorld.h"
+#include "AI/System/Spatial/XVSpatialHashGrid.h"
+#include "GameFramework/Character.h"
+#include "Engine/OverlapResult.h"
+#include "EngineUtils.h"
+
+// 100/500/2000 개의 캡슐 캐릭터를 빈 테스트 월드에 뿌리고
+// 액터 순회 + 거리 비교 / Sphere Overlap / 공간 격자 쿼리 시간을 비교
+// 빈 월드라 세 방식 모두 같은 에이전트 집합만 대상으로 함 (플레이어/실제 적 없음)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FXVEnemySpatialGridPerfTest, "XV.AI.SpatialGrid.QueryPerf",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FXVEnemySpatialGridPerfTest::RunTest(const FString& Parameters)
+{
+	FXVTestWorld TestWorld;
+	UWorld* World = TestWorld.Get();
+
+	constexpr int32 NumQueries = 200;
+	constexpr float Radius = 1000.f;
+	constexpr float HalfExtent = 10000.f;
+	constexpr float AgentZ = 100.f;
+	const int32 AgentCounts[] = { 100, 500, 2000 };
+
+	FRandomStream Stream(12345);
+	TArray<FVector> QueryPoints;
+	QueryPoints.Reserve(NumQueries);
+	for (int32 i = 0; i < NumQueries; ++i)
+	{
+		QueryPoints.Add(FVector(Stream.FRandRange(-HalfExtent, HalfExtent), Stream.FRandRange(-HalfExtent, HalfExtent), AgentZ));
+	}
+
+	TArray<FOverlapResult> Overlaps;
+	TArray<int32> GridResults;
+	const FCollisionShape Sphere = FCollisionShape::MakeSphere(Radius);
+	const FCollisionObjectQueryParams ObjectParams(ECC_Pawn);
+
+	for (const int32 AgentCount : AgentCounts)
+	{
+		TArray<ACharacter*> Agents;
+		Agents.Reserve(AgentCount);
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		for (int32 i = 0; i < AgentCount; ++i)
+		{
+			const FVector Location(Stream.FRandRange(-HalfExtent, HalfExtent), Stream.FRandRange(-HalfExtent, HalfExtent), AgentZ);
+			if (ACharacter* Agent = World->SpawnActor<ACharacter>(ACharacter::StaticClass(), Location, FRotator::ZeroRotator, SpawnParams))
+			{
+				Agents.Add(Agent);
+			}
+		}
+		TestEqual(TEXT("Spawned agents"), Agents.Num(), AgentCount);
+
+		int32 TotalActorIterator = 0;
+		int32 TotalOverlap = 0;
+		int32 TotalGrid = 0;
+
+		// [1] 액터 순회 + 거리 비교
+		double StartTime = FPlatformTime::Seconds();
+		for (const FVector& Point : QueryPoints)
+		{
+			for (TActorIterator<ACharacter> It(World); It; ++It)
+			{
+				TotalActorIterator += FVector::DistSquared(It->GetActorLocation(), Point) <= FMath::Square(Radius) ? 1 : 0;
+			}
+		}
+		const double ActorIteratorMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		// [2] Sphere Overlap (Pawn 채널, 캡슐 두께만큼 더 잡히므로 개수는 참고용)
+		StartTime = FPlatformTime::Seconds();
+		for (const FVector& Point : QueryPoints)
+		{
+			Overlaps.Reset();
+			World->OverlapMultiByObjectType(Overlaps, Point, FQuat::Identity, ObjectParams, Sphere);
+			TotalOverlap += Overlaps.Num();
+		}
+		const double OverlapMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		// [3] 공간 격자 (구축 포함)
+		StartTime = FPlatformTime::Seconds();
+		FXVSpatialHashGrid Grid(500.f);
+		for (const ACharacter* Agent : Agents)
+		{
+			Grid.Add(Agent->GetActorLocation());
+		}
+		const double GridBuildMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		StartTime = FPlatformTime::Seconds();
+		for (const FVector& Point : QueryPoints)
+		{
+			TotalGrid += Grid.QueryRadius(Point, Radius, GridResults);
+		}
+		const double GridMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		// 같은 집합/같은 거리 조건이므로 결과 수가 같아야 함
+		TestEqual(FString::Printf(TEXT("Grid matches actor iteration (Agents=%d)"), AgentCount), TotalGrid, TotalActorIterator);
+
+		AddInfo(FString::Printf(TEXT("Agents=%d Queries=%d Radius=%.0f | ActorIterator %.3fms (%d) | Overlap %.3fms (%d) | Grid %.3fms + build %.3fms (%d)"),
+			Agents.Num(), NumQueries, Radius, ActorIteratorMs, TotalActorIterator, OverlapMs, TotalOverlap, GridMs, GridBuildMs, TotalGrid));
+
+		for (ACharacter* Agent : Agents)
+		{
+			Agent->Destroy();
+		}
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,99 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Tests/XVTestWorld.h"
+#include "AI/Data/Perception/XVPerceptionProfile.h"
+#include "AI/System/AIController/Base/XVControllerBase.h"
+#include "Perception/AISenseConfig_Sight.h"
+#include "Perception/AISenseConfig_Hearing.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FXVPerceptionProfileValidationTest, "XV.AI.PerceptionProfile.Validation",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FXVPerceptionProfileValidationTest::RunTest(const FString& Parameters)
+{
+	// 잘못된 값 하나씩 넣어서 에러가 나는지 확인
+	auto CountErrors = [](TFunctionRef<void(UXVPerceptionProfile&)> Modify, int32& OutWarnings)
+	{
+		UXVPerceptionProfile* Profile = NewObject<UXVPerceptionProfile>();
+		Modify(*Profile);
+
+		TArray<FText> Errors;
+		TArray<FText> Warnings;
+		Profile->Validate(Errors, Warnings);
+		OutWarnings = Warnings.Num();
+		return Errors.Num();
+	};
+
+	int32 Warnings = 0;
+	TestEqual(TEXT("Default profile is valid"), CountErrors([](UXVPerceptionProfile&) {}, Warnings), 0);
+	TestEqual(TEXT("Default profile has no warnings"), Warnings, 0);
+
+	TestEqual(TEXT("SightRadius 0"), CountErrors([](UXVPerceptionProfile& P) { P.SightRadius = 0.f; }, Warnings), 1);
+	TestEqual(TEXT("LoseSightRadius < SightRadius"), CountErrors([](UXVPerceptionProfile& P) { P.LoseSightRadius = P.SightRadius - 1.f; }, Warnings), 1);
+	TestEqual(TEXT("Vision angle 0"), CountErrors([](UXVPerceptionProfile& P) { P.PeripheralVisionAngleDegrees = 0.f; }, Warnings), 1);
+	TestEqual(TEXT("Vision angle > 180"), CountErrors([](UXVPerceptionProfile& P) { P.PeripheralVisionAngleDegrees = 181.f; }, Warnings), 1);
+	TestEqual(TEXT("HearingRange 0"), CountErrors([](UXVPerceptionProfile& P) { P.HearingRange = 0.f; }, Warnings), 1);
+
+	// 감지 대상이 없으면 경고만 (에러 아님)
+	TestEqual(TEXT("No affiliation is not an error"), CountErrors([](UXVPerceptionProfile& P)
+	{
+		P.bDetectEnemies = false;
+		P.bDetectNeutrals = false;
+		P.bDetectFriendlies = false;
+	}, Warnings), 0);
+	TestEqual(TEXT("No affiliation warns"), Warnings, 1);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FXVPerceptionProfileApplyTest, "XV.AI.PerceptionProfile.ApplyToController",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FXVPerceptionProfileApplyTest::RunTest(const FString& Parameters)
+{
+	FXVTestWorld TestWorld;
+
+	AXVControllerBase* Controller = TestWorld.Get()->SpawnActor<AXVControllerBase>();
+	if (!TestNotNull(TEXT("Controller spawned"), Controller)) return false;
+
+	UXVPerceptionProfile* Profile = NewObject<UXVPerceptionProfile>();
+	Profile->SightRadius = 2345.f;
+	Profile->LoseSightRadius = 3456.f;
+	Profile->PeripheralVisionAngleDegrees = 75.f;
+	Profile->SightMaxAge = 3.f;
+	Profile->HearingRange = 1234.f;
+	Profile->HearingMaxAge = 4.f;
+	Profile->bDetectEnemies = true;
+	Profile->bDetectNeutrals = false;
+	Profile->bDetectFriendlies = false;
+
+	Controller->ApplyPerceptionProfile(Profile, false);
+
+	TestTrue(TEXT("Applied profile recorded"), Controller->GetAppliedPerceptionProfile() == Profile);
+
+	const UAISenseConfig_Sight* Sight = Controller->AISightConfig;
+	TestEqual(TEXT("SightRadius"), Sight->SightRadius, 2345.f);
+	TestEqual(TEXT("LoseSightRadius"), Sight->LoseSightRadius, 3456.f);
+	TestEqual(TEXT("PeripheralVisionAngleDegrees"), Sight->PeripheralVisionAngleDegrees, 75.f);
+	TestEqual(TEXT("Sight MaxAge"), Sight->GetMaxAge(), 3.f);
+	TestTrue(TEXT("Sight detects enemies"), Sight->DetectionByAffiliation.bDetectEnemies);
+	TestFalse(TEXT("Sight ignores neutrals"), Sight->DetectionByAffiliation.bDetectNeutrals);
+	TestFalse(TEXT("Sight ignores friendlies"), Sight->DetectionByAffiliation.bDetectFriendlies);
+
+	const UAISenseConfig_Hearing* Hearing = Controller->AIHearingConfig;
+	TestEqual(TEXT("HearingRange"), Hearing->HearingRange, 1234.f);
+	TestEqual(TEXT("Hearing MaxAge"), Hearing->GetMaxAge(), 4.f);
+	TestFalse(TEXT("Hearing ignores neutrals"), Hearing->DetectionByAffiliation.bDetectNeutrals);
+
+	// 프로필이 없으면 기존 값 유지
+	Controller->ApplyPerceptionProfile(nullptr, false);
+	TestTrue(TEXT("Null profile keeps previous profile"), Controller->GetAppliedPerceptionProfile() == Profile);
+	TestEqual(TEXT("Null profile keeps SightRadius"), Sight->SightRadius, 2345.f);
+
+	return true;
+}
+
+#endif
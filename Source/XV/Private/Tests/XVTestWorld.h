@@ -0,0 +1,37 @@
+#pragma once
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "CoreMinimal.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+// 자동화 테스트용 임시 게임 월드 (스코프가 끝나면 정리)
+struct FXVTestWorld
+{
+	FXVTestWorld()
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("XVTestWorld"));
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+
+		const FURL URL;
+		World->InitializeActorsForPlay(URL);
+	}
+
+	~FXVTestWorld()
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+	}
+
+	UWorld* Get() const { return World; }
+
+	// BeginPlay 까지 호출 (서브시스템 등록/틱이 필요한 테스트용)
+	void BeginPlay() const { World->BeginPlay(); }
+
+private:
+	UWorld* World = nullptr;
+};
+
+#endif
@@ -29,7 +29,7 @@ void AArrivalPoint::OnArrivalPointBeginOverlap(
 {
 	if (AXVGameState* GS = GetWorld() ? GetWorld()->GetGameState<AXVGameState>() : nullptr)
 	{
-		if (GS->CanActiveArrivalPoint)
+		if (GS->CanActiveArrivalPoint())
 		{
 			if (OtherActor && OtherActor->ActorHasTag("Player"))
 			{	
@@ -1,6 +1,8 @@
 #include "World/SpawnVolume.h"
+#include "XV.h"
 #include "Data/EnemySpawnRow.h"
 #include "Components/BoxComponent.h"
+#include "System/XVRandomStreamSubsystem.h"
 
 ASpawnVolume::ASpawnVolume()
 {
@@ -39,7 +41,7 @@ FEnemySpawnRow* ASpawnVolume::GetRandomEnemy() const
 			TotalChance += Row->SpawnChance;
 		}
 	}
-	const float RandValue = FMath::FRandRange(0.0f, TotalChance);
+	const float RandValue = UXVRandomStreamSubsystem::FRandRange(this, UXVRandomStreamSubsystem::SpawnDomain, 0.0f, TotalChance);
 	float AccumulateChance = 0.0f;
 
 	for (FEnemySpawnRow* Row : AllRows)
@@ -60,6 +62,8 @@ FVector ASpawnVolume::GetEnemySpawnPoint() const
 
 AActor* ASpawnVolume::SpawnEnemy(TSubclassOf<AActor> EnemyClass)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(ASpawnVolume::SpawnEnemy);
+
 	if (!EnemyClass) return nullptr;
 	
 	AActor* SpawnedActor = GetWorld()->SpawnActor<AActor>(
@@ -71,6 +75,8 @@ AActor* ASpawnVolume::SpawnEnemy(TSubclassOf<AActor> EnemyClass)
 }
 AActor* ASpawnVolume::SpawnRandomEnemy()
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(ASpawnVolume::SpawnRandomEnemy);
+
 	if (FEnemySpawnRow* SelectedRow = GetRandomEnemy())
 	{
 		if (UClass* ActualClass = SelectedRow->EnemyClass.Get())
@@ -80,3 +86,26 @@ AActor* ASpawnVolume::SpawnRandomEnemy()
 	}
 	return nullptr;
 }
+
+AActor* ASpawnVolume::SpawnEnemyInBox(TSubclassOf<AActor> EnemyClass)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(ASpawnVolume::SpawnEnemyInBox);
+
+	if (!EnemyClass) return nullptr;
+
+	const FVector Extent = SpawningBox->GetScaledBoxExtent();
+	const FVector Offset(
+		UXVRandomStreamSubsystem::FRandRange(this, UXVRandomStreamSubsystem::SpawnDomain, -Extent.X, Extent.X),
+		UXVRandomStreamSubsystem::FRandRange(this, UXVRandomStreamSubsystem::SpawnDomain, -Extent.Y, Extent.Y),
+		0.f);
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	return GetWorld()->SpawnActor<AActor>(
+		EnemyClass,
+		GetEnemySpawnPoint() + Offset,
+		FRotator::ZeroRotator,
+		SpawnParams
+	);
+}
@@ -0,0 +1,67 @@
+#include "XVHitScan.h"
+#include "XV.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/SkeletalMeshSocket.h"
+
+bool FXVSocketCache::GetSocketTransform(const USkeletalMeshComponent* Mesh, FName SocketName, FTransform& OutTransform)
+{
+	if (!Mesh)
+	{
+		OutTransform = FTransform::Identity;
+		return false;
+	}
+
+	// 소켓/본 인덱스는 메쉬나 소켓 이름이 바뀔 때만 다시 찾음
+	const USkeletalMesh* MeshAsset = Mesh->GetSkeletalMeshAsset();
+	if (!bResolved || CachedMesh.Get() != MeshAsset || CachedSocketName != SocketName)
+	{
+		CachedMesh = MeshAsset;
+		CachedSocketName = SocketName;
+		Socket = MeshAsset ? MeshAsset->FindSocket(SocketName) : nullptr;
+		BoneIndex = Socket ? Mesh->GetBoneIndex(Socket->BoneName) : INDEX_NONE;
+		bResolved = true;
+	}
+
+	if (!Socket || BoneIndex == INDEX_NONE)
+	{
+		OutTransform = Mesh->GetComponentTransform();
+		return false;
+	}
+
+	OutTransform = Socket->GetSocketLocalTransform() * Mesh->GetBoneTransform(BoneIndex);
+	return true;
+}
+
+void FXVSocketCache::Invalidate()
+{
+	bResolved = false;
+	Socket = nullptr;
+	BoneIndex = INDEX_NONE;
+}
+
+int32 FXVHitScan::TraceBatch(const UWorld* World, const FVector& Origin, TConstArrayView<FVector> Directions, float Range,
+	ECollisionChannel Channel, const FCollisionQueryParams& QueryParams, TArray<FHitResult, TInlineAllocator<16>>& OutHits)
+{
+	OutHits.Reset(Directions.Num());
+	if (!World) return 0;
+
+	int32 NumHits = 0;
+	for (const FVector& Direction : Directions)
+	{
+		const FVector End = Origin + Direction * Range;
+
+		FHitResult& Hit = OutHits.AddDefaulted_GetRef();
+		XV_COUNT_TRACE();
+		if (World->LineTraceSingleByChannel(Hit, Origin, End, Channel, QueryParams))
+		{
+			NumHits++;
+		}
+		else
+		{
+			Hit.TraceStart = Origin;
+			Hit.TraceEnd = End;
+		}
+	}
+	return NumHits;
+}
@@ -0,0 +1,70 @@
+#include "XVSpread.h"
+
+float FXVSpreadModel::ConsumeShot(const FXVSpreadParams& Params, FXVSpreadState& State, double Now)
+{
+	// 지난 발 이후 회복
+	const float Elapsed = static_cast<float>(FMath::Max(Now - State.LastShotTime, 0.0));
+	State.RecoilDegrees = FMath::Max(0.f, State.RecoilDegrees - Params.RecoilRecoveryPerSecond * Elapsed);
+	State.LastShotTime = Now;
+
+	const float HalfAngle = FMath::Min(Params.BaseSpreadDegrees + State.RecoilDegrees, Params.MaxSpreadDegrees);
+	State.RecoilDegrees = FMath::Min(State.RecoilDegrees + Params.RecoilPerShotDegrees, FMath::Max(Params.MaxSpreadDegrees - Params.BaseSpreadDegrees, 0.f));
+	return HalfAngle;
+}
+
+void FXVSpreadModel::EvaluatePellets(const FVector& Forward, float HalfAngleDegrees, int32 NumPellets, FRandomStream& Stream, TArray<FVector, TInlineAllocator<16>>& OutDirections)
+{
+	NumPellets = FMath::Max(NumPellets, 1);
+	OutDirections.SetNumUninitialized(NumPellets);
+
+	const FVector Axis = Forward.GetSafeNormal();
+	if (HalfAngleDegrees <= UE_KINDA_SMALL_NUMBER)
+	{
+		for (FVector& Direction : OutDirections)
+		{
+			Direction = Axis;
+		}
+		return;
+	}
+
+	// 1) 난수를 고정 순서로 먼저 뽑음 (탄 수가 같으면 스트림 소비량도 같음)
+	TArray<float, TInlineAllocator<16>> CosTheta;
+	TArray<float, TInlineAllocator<16>> Phi;
+	CosTheta.SetNumUninitialized(NumPellets);
+	Phi.SetNumUninitialized(NumPellets);
+	for (int32 i = 0; i < NumPellets; i++)
+	{
+		CosTheta[i] = Stream.GetFraction();
+		Phi[i] = Stream.GetFraction();
+	}
+
+	// 2) 원뿔 안 균일 분포 (cos 을 [cos(반각), 1] 에서 균일하게)
+	const float CosHalfAngle = FMath::Cos(FMath::DegreesToRadians(HalfAngleDegrees));
+	for (int32 i = 0; i < NumPellets; i++)
+	{
+		CosTheta[i] = 1.f - CosTheta[i] * (1.f - CosHalfAngle);
+		Phi[i] *= UE_TWO_PI;
+	}
+
+	// 3) 원뿔 축 기준 좌표계로 방향 계산
+	FVector Right;
+	FVector Up;
+	Axis.FindBestAxisVectors(Right, Up);
+	for (int32 i = 0; i < NumPellets; i++)
+	{
+		const float SinTheta = FMath::Sqrt(FMath::Max(0.f, 1.f - CosTheta[i] * CosTheta[i]));
+		float SinPhi;
+		float CosPhi;
+		FMath::SinCos(&SinPhi, &CosPhi, Phi[i]);
+		OutDirections[i] = Axis * CosTheta[i] + (Right * CosPhi + Up * SinPhi) * SinTheta;
+	}
+}
+
+float FXVSpreadModel::GetDamageScale(const FXVSpreadParams& Params, float Distance)
+{
+	if (Distance <= Params.FalloffStartDistance) return 1.f;
+	if (Params.FalloffEndDistance <= Params.FalloffStartDistance) return Params.MinDamageScale;
+
+	const float Alpha = FMath::Clamp((Distance - Params.FalloffStartDistance) / (Params.FalloffEndDistance - Params.FalloffStartDistance), 0.f, 1.f);
+	return FMath::Lerp(1.f, Params.MinDamageScale, Alpha);
+}
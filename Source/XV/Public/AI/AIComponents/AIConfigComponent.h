@@ -4,6 +4,9 @@
 #include "Components/ActorComponent.h"
 #include "AIConfigComponent.generated.h"
 
+class UXVPerceptionProfile;
+class UStaticMesh;
+
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class XV_API UAIConfigComponent : public UActorComponent
 {
@@ -16,6 +19,16 @@ public:
 	UFUNCTION(BlueprintCallable)
 	void ConfigSetting();
 
+	// 실제 적용된 청각 범위 (프로필 또는 개별 설정 값)
+	FORCEINLINE float GetHearingRange() const { return ResolvedHearingRange; }
+
+public:
+//=== 퍼셉션 프로필 ====================================================================================================//
+	// 개별 적에게 다른 프로필이 필요할 때만 지정 (비우면 컨트롤러의 적 타입 프로필 사용)
+	// 둘 다 없으면 아래 개별 수치를 사용 (이 경우 리스너 재등록 발생)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI | Setting")
+	TObjectPtr<UXVPerceptionProfile> PerceptionProfile;
+
 public:
 // === AI 공격 가능 범위 ================================================================================================//	
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI | Setting")
@@ -61,4 +74,55 @@ public:
 	// 아군 감지
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI | Setting")
 	bool AIbDetectFriendlies;
+
+//=== 군중 회피 (적 타입별 선택) =========================================================================================//
+public:
+	// 켜면 UXVCrowdAvoidanceSubsystem 이 이웃 적을 피하는 속도를 이동에 더함
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI | Crowd")
+	bool bUseCrowdAvoidance;
+
+	// 이웃으로 볼 거리
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI | Crowd", meta = (EditCondition = "bUseCrowdAvoidance", ClampMin = "0"))
+	float CrowdNeighborRadius;
+
+	// 회피 속도 비율 (최대 속도 대비)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI | Crowd", meta = (EditCondition = "bUseCrowdAvoidance", ClampMin = "0", ClampMax = "1"))
+	float CrowdAvoidanceWeight;
+
+	// 몇 초 앞까지 충돌을 예측할지
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI | Crowd", meta = (EditCondition = "bUseCrowdAvoidance", ClampMin = "0"))
+	float CrowdTimeHorizon;
+
+	// 고려할 최대 이웃 수
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI | Crowd", meta = (EditCondition = "bUseCrowdAvoidance", ClampMin = "0"))
+	int32 CrowdMaxNeighbors;
+
+//=== 원거리 임포스터 (적 타입별 선택) ===================================================================================//
+public:
+	// 켜면 멀리 있는 동안 스켈레탈 메쉬 대신 UXVEnemyImpostorSubsystem 의 인스턴스 메쉬로 그림
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI | Impostor")
+	bool bUseImpostor;
+
+	// 버텍스 애니메이션 텍스처(VAT)를 구운 스태틱 메쉬 (머티리얼이 인스턴스 커스텀 데이터 4개를 읽어야 함)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI | Impostor", meta = (EditCondition = "bUseImpostor"))
+	TObjectPtr<UStaticMesh> ImpostorMesh;
+
+	// 카메라에서 이 거리보다 멀면 임포스터로 전환
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI | Impostor", meta = (EditCondition = "bUseImpostor", ClampMin = "0"))
+	float ImpostorDistance;
+
+	// VAT 안의 대기 애니메이션 구간 (X = 시작 프레임, Y = 프레임 수)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI | Impostor", meta = (EditCondition = "bUseImpostor"))
+	FIntPoint ImpostorIdleFrames;
+
+	// VAT 안의 이동 애니메이션 구간 (X = 시작 프레임, Y = 프레임 수)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI | Impostor", meta = (EditCondition = "bUseImpostor"))
+	FIntPoint ImpostorMoveFrames;
+
+	// 이동 애니메이션이 1배속으로 재생되는 속도 (구울 때 기준 속도)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI | Impostor", meta = (EditCondition = "bUseImpostor", ClampMin = "1"))
+	float ImpostorMoveReferenceSpeed;
+
+private:
+	float ResolvedHearingRange;
 };
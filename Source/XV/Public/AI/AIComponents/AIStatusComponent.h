@@ -4,6 +4,8 @@
 #include "Components/ActorComponent.h"
 #include "AIStatusComponent.generated.h"
 
+DECLARE_MULTICAST_DELEGATE(FOnAIDeath);
+
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class XV_API UAIStatusComponent : public UActorComponent
 {
@@ -14,10 +16,17 @@ public:
 
 public:
 	virtual void TakeDamage(float Damage);
+
+	FORCEINLINE bool IsDead() const { return bIsDead; }
+
+	// 체력이 0 이하가 되는 순간 한 번 호출 (액터 파괴 직전)
+	FOnAIDeath OnDeath;
 	
 private:
 	UPROPERTY(EditAnywhere, Category = "AI Status")
 	float Health;
+
+	bool bIsDead = false;
 	
 public:
 	UPROPERTY(EditAnywhere, Category = "AI Status")
@@ -0,0 +1,24 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "XVEnemyMovementComponent.generated.h"
+
+// 군중 회피 속도를 경로 추적 이동 요청에 더해주는 적 전용 이동 컴포넌트
+UCLASS()
+class XV_API UXVEnemyMovementComponent : public UCharacterMovementComponent
+{
+	GENERATED_BODY()
+
+public:
+	virtual void RequestDirectMove(const FVector& MoveVelocity, bool bForceMaxSpeed) override;
+
+	// UXVCrowdAvoidanceSubsystem 이 매 틱 계산해서 넣어줌
+	void SetCrowdAvoidanceVelocity(const FVector& InVelocity);
+	void ClearCrowdAvoidanceVelocity();
+
+	FORCEINLINE const FVector& GetCrowdAvoidanceVelocity() const { return CrowdAvoidanceVelocity; }
+
+private:
+	FVector CrowdAvoidanceVelocity = FVector::ZeroVector;
+};
@@ -15,7 +15,7 @@ class XV_API AXVEnemyBase : public ACharacter
 	GENERATED_BODY()
 
 public:
-	AXVEnemyBase();
+	AXVEnemyBase(const FObjectInitializer& ObjectInitializer);
 protected:
 	virtual void BeginPlay() override;
 	virtual void Destroyed() override;
@@ -35,6 +35,13 @@ protected:
 public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AI")
 	TObjectPtr<AAIWeaponBase> AIWeaponBase;
+
+	FORCEINLINE UAIConfigComponent* GetAIConfigComponent() const { return AIConfigComponent; }
+
+// === 사망 처리 =======================================================================================================//
+protected:
+	// 스테이터스 컴포넌트의 사망 이벤트 (처치 집계는 여기서만)
+	void HandleDeath();
 	
 // === 무기 관련 세팅 ===================================================================================================//
 protected:
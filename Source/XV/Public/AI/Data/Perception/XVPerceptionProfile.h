@@ -0,0 +1,68 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "XVPerceptionProfile.generated.h"
+
+class UAISenseConfig_Sight;
+class UAISenseConfig_Hearing;
+
+/**
+ * 적 타입별로 공유하는 퍼셉션(눈/귀) 설정
+ * 컨트롤러 생성 시 감각 설정에 적용되어 리스너가 처음부터 올바른 값으로 등록됨
+ */
+UCLASS(BlueprintType)
+class XV_API UXVPerceptionProfile : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	// 눈/귀 감각 설정에 값 적용
+	void ApplyTo(UAISenseConfig_Sight& SightConfig, UAISenseConfig_Hearing& HearingConfig) const;
+
+	// 값 검증 (에디터 데이터 검증과 자동화 테스트에서 공용), 에러가 없으면 true
+	bool Validate(TArray<FText>& OutErrors, TArray<FText>& OutWarnings) const;
+
+#if WITH_EDITOR
+	virtual EDataValidationResult IsDataValid(class FDataValidationContext& Context) const override;
+#endif
+
+//=== 귀 설정 ==========================================================================================================//
+public:
+	// 청각 범위
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Hearing", meta = (ClampMin = "0.0"))
+	float HearingRange = 1000.f;
+
+	// 청각 기억력
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Hearing", meta = (ClampMin = "0.0"))
+	float HearingMaxAge = 10.f;
+
+//=== 눈 설정 ==========================================================================================================//
+public:
+	// 시야 범위
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Sight", meta = (ClampMin = "0.0"))
+	float SightRadius = 1000.f;
+
+	// 시야를 잃는 범위 (시야 범위 이상이어야 함)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Sight", meta = (ClampMin = "0.0"))
+	float LoseSightRadius = 1500.f;
+
+	// 시야각
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Sight", meta = (ClampMin = "0.0", ClampMax = "180.0"))
+	float PeripheralVisionAngleDegrees = 180.f;
+
+	// 시야 기억력
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Sight", meta = (ClampMin = "0.0"))
+	float SightMaxAge = 10.f;
+
+//=== 감지 대상 (눈/귀 공통) ============================================================================================//
+public:
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Affiliation")
+	bool bDetectEnemies = true;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Affiliation")
+	bool bDetectNeutrals = true;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Affiliation")
+	bool bDetectFriendlies = true;
+};
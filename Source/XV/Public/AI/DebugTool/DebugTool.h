@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include "DrawDebugHelpers.h"
+#include "AI/DebugTool/XVLogThrottle.h"
 
 #define DRAW_SPHERE(Location) if(GetWorld()) DrawDebugSphere(GetWorld(), Location, 100.f, 24, FColor::Red, false, 60.f, 0, 1.f); // 원형 디버깅 툴 : 지정된 위치에 구체 생성
 #define DRAW_LINE(Start, End) if(GetWorld()) DrawDebugLine(GetWorld(), Start, End, FColor::Red, false, 60.f, 0, 1.f);			 // 라인 디버깅 툴 : 두 점사이에 선을 그림
@@ -8,4 +9,9 @@
 
 #define LENGTH_VECTOR(ActorLocation, ForwardLocation) (ActorLocation + (ForwardLocation * 100.f))								 // 길이 계산 : 방향 백터 계산
 
+// Shipping/Test 빌드에서는 Log_XV_AI 로그를 컴파일 단계에서 제거
+#if UE_BUILD_SHIPPING || UE_BUILD_TEST
+DECLARE_LOG_CATEGORY_EXTERN(Log_XV_AI, Log, NoLogging);
+#else
 DECLARE_LOG_CATEGORY_EXTERN(Log_XV_AI, Log, All);
+#endif
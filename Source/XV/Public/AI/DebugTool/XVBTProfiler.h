@@ -0,0 +1,74 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class UBTNode;
+class UBehaviorTreeComponent;
+class UBlackboardComponent;
+
+#if !UE_BUILD_SHIPPING
+
+// 노드 하나(적 타입별)의 누적 실행 정보
+struct FXVBTNodeStats
+{
+	FString EnemyType;
+	FString TreeName;
+	FString NodeName;
+	FString NodeClass;
+	int64 Count = 0;
+	double TotalMs = 0.0;
+	double MaxMs = 0.0;
+	// 실행 중 값이 바뀐 블랙보드 키 (중복 없음)
+	TArray<FName> WrittenKeys;
+};
+
+/**
+ * XV 비헤이비어 트리 노드 프로파일러 (게임 스레드 전용, Shipping 에서는 제외)
+ * - XV.AI.BTProfiler.Enable 1 일 때만 기록 (꺼져 있으면 스코프 비용은 cvar 확인 한 번)
+ * - 적 클래스 x 노드 별 실행 횟수, 총/최대 시간, 실행 중 바뀐 블랙보드 키를 누적
+ * - XV.AI.BTProfiler.Dump [N] : 총 시간 상위 N개 로그 출력
+ * - XV.AI.BTProfiler.CSV [경로] : CSV 저장 (기본 Saved/Profiling)
+ * - XV.AI.BTProfiler.Reset : 누적값 초기화
+ */
+class XV_API FXVBTProfiler
+{
+public:
+	static FXVBTProfiler& Get();
+	static bool IsEnabled();
+
+	void Record(const UBTNode* Node, const UBehaviorTreeComponent& OwnerComp, double Ms, TConstArrayView<FName> ChangedKeys);
+	void Reset();
+	void Dump(int32 MaxRows) const;
+	bool ExportCSV(const FString& Path) const;
+
+private:
+	// 총 시간 내림차순으로 정렬된 목록
+	TArray<const FXVBTNodeStats*> GetSortedStats() const;
+
+	TMap<TPair<FObjectKey, FObjectKey>, FXVBTNodeStats> Stats;
+	double StartTime = FPlatformTime::Seconds();
+};
+
+// 노드 실행 함수 하나를 측정 (시작/끝 블랙보드 값을 비교해서 바뀐 키 기록)
+class XV_API FXVBTProfileScope
+{
+public:
+	FXVBTProfileScope(const UBTNode* InNode, const UBehaviorTreeComponent& InOwnerComp);
+	~FXVBTProfileScope();
+
+private:
+	const UBTNode* Node = nullptr;
+	const UBehaviorTreeComponent* OwnerComp = nullptr;
+	const UBlackboardComponent* Blackboard = nullptr;
+	uint64 StartCycles = 0;
+	TArray<uint8, TInlineAllocator<256>> BlackboardSnapshot;
+};
+
+#define XV_BT_PROFILE_SCOPE(OwnerComp) FXVBTProfileScope XVBTProfileScope(this, OwnerComp)
+
+#else
+
+#define XV_BT_PROFILE_SCOPE(OwnerComp)
+
+#endif
@@ -0,0 +1,43 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 호출 위치별 토큰 버킷 (XV_LOG_THROTTLED 에서 static 으로 하나씩 생성)
+ * - 초당 XV.Log.ThrottleRate 개 충전, 최대 XV.Log.ThrottleBurst 개까지 연속 출력
+ * - 버려진 로그 수는 다음에 출력되는 로그 앞에 "(suppressed N)" 으로 붙임
+ */
+class XV_API FXVLogThrottle
+{
+public:
+	// 출력 가능하면 true, OutSuppressedCount 에 그동안 버려진 개수 반환 후 0으로 초기화
+	bool TryConsume(int32& OutSuppressedCount);
+
+private:
+	FCriticalSection Mutex;
+	double Tokens = -1.0;
+	double LastRefillTime = 0.0;
+	int32 SuppressedCount = 0;
+};
+
+// 호출 위치별로 빈도를 제한하는 UE_LOG (컴파일/런타임 Verbosity 로 꺼져 있으면 버킷도 건드리지 않음)
+#define XV_LOG_THROTTLED(CategoryName, Verbosity, Format, ...) \
+	do \
+	{ \
+		if (UE_LOG_ACTIVE(CategoryName, Verbosity)) \
+		{ \
+			static FXVLogThrottle XVLogThrottle; \
+			int32 XVSuppressedCount = 0; \
+			if (XVLogThrottle.TryConsume(XVSuppressedCount)) \
+			{ \
+				if (XVSuppressedCount > 0) \
+				{ \
+					UE_LOG(CategoryName, Verbosity, TEXT("(suppressed %d) ") Format, XVSuppressedCount, ##__VA_ARGS__); \
+				} \
+				else \
+				{ \
+					UE_LOG(CategoryName, Verbosity, Format, ##__VA_ARGS__); \
+				} \
+			} \
+		} \
+	} while (0)
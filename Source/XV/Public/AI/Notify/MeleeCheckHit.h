@@ -7,7 +7,8 @@
 
 class AAIWeaponMeleeBase;
 /**
- * 
+ * 근접 판정 구간 (Begin ~ End 동안 매 프레임 무기 박스를 이전 위치에서 현재 위치로 스윕)
+ * 노티파이 인스턴스는 같은 애니메이션을 쓰는 모든 적이 공유하므로 상태는 무기 쪽에 둠
  */
 UCLASS()
 class XV_API UMeleeCheckHit : public UAnimNotifyState
@@ -16,10 +17,9 @@ class XV_API UMeleeCheckHit : public UAnimNotifyState
 
 public:
 	virtual void NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference) override;
+	virtual void NotifyTick(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float FrameDeltaTime, const FAnimNotifyEventReference& EventReference) override;
+	virtual void NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference) override;
 
-	
-protected:
-	UPROPERTY()
-	AAIWeaponMeleeBase* CurrentWeapon;
-	
+private:
+	static AAIWeaponMeleeBase* GetMeleeWeapon(const USkeletalMeshComponent* MeshComp);
 };
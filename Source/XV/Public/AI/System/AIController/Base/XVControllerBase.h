@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "AIController.h"
+#include "System/XVGameState.h"
 #include "XVControllerBase.generated.h"
 
 class UAISenseConfig_Hearing;
@@ -10,6 +11,9 @@ class UAIPerceptionComponent;
 class UBlackboardComponent;
 class UXVDataAssetBase;
 class UXVBlackBoardDataBase;
+class UXVPerceptionRouterSubsystem;
+class UXVTargetSelectionSubsystem;
+class UXVPerceptionProfile;
 
 UCLASS()
 class XV_API AXVControllerBase : public AAIController
@@ -28,11 +32,16 @@ public:
 public:
 	AXVControllerBase();
 protected:
+	virtual void PostInitProperties() override;
 	virtual void OnPossess(APawn* InPawn) override;
 	virtual void BeginPlay() override;
 	virtual void Tick(float DeltaSeconds) override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 #pragma endregion
+
+public:
+	// 길찾기 요청 집계 (스트레스 테스트)
+	virtual FPathFollowingRequestResult MoveTo(const FAIMoveRequest& MoveRequest, FNavPathSharedPtr* OutPath = nullptr) override;
 	
 #pragma region AIAction // AI 행동 관련 바인딩 함수
 //---------------------------------------------------------------------------------------------------------------------//
@@ -40,6 +49,11 @@ protected:
 	
 	UFUNCTION()
 	void OnTargetInfoUpdated(AActor* Actor, FAIStimulus Stimulus); // 감지한 타겟 정보 업데이트
+
+	UFUNCTION()
+	void OnGameProgressChanged(const FXVGameProgress& NewProgress, const FXVGameProgress& OldProgress); // 게임 진행 상태 변경 알림
+
+	void EnterAttackMode(); // 블랙보드 공격 모드 + 공격 속도
 	
 #pragma endregion 
 
@@ -49,6 +63,12 @@ public:
 	// 블랙 보드 getter 
 	FORCEINLINE UBlackboardComponent* GetBlackboardComp() const { return AIBlackBoard; }
 
+	// 현재 감각 설정에 적용된 퍼셉션 프로필
+	FORCEINLINE UXVPerceptionProfile* GetAppliedPerceptionProfile() const { return AppliedPerceptionProfile; }
+
+	// 퍼셉션 프로필 적용 (리스너 등록 이후에 바꾸는 경우에만 bRequestListenerUpdate = true)
+	void ApplyPerceptionProfile(UXVPerceptionProfile* Profile, bool bRequestListenerUpdate);
+
 private:
 	// DataAsset 값들을 로그로 출력하는 함수 (퍼셉션 관련 필수만)
 	void LogDataAssetValues() const;
@@ -70,6 +90,10 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AI | Components")
 	TObjectPtr<UAIPerceptionComponent> AIPerception;
 
+	// 적 타입별 퍼셉션 프로필 (컨트롤러 생성 시 적용 → 리스너 재등록 없음)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "AI | Perception")
+	TObjectPtr<UXVPerceptionProfile> PerceptionProfile;
+
 	// 눈
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AI | Components")
 	TObjectPtr<UAISenseConfig_Sight> AISightConfig;
@@ -81,5 +105,17 @@ public:
 	// 블랙 보드 컴포넌트
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI | Components")
 	TObjectPtr<UBlackboardComponent> AIBlackBoard;
+
+private:
+	// 퍼셉션 라우터 (플레이어 판별, 발견 알림 묶음 처리)
+	UPROPERTY(Transient)
+	TObjectPtr<UXVPerceptionRouterSubsystem> PerceptionRouter;
+
+	// 타겟 선택 (여러 플레이어 중 가장 가깝거나 위협적인 대상)
+	UPROPERTY(Transient)
+	TObjectPtr<UXVTargetSelectionSubsystem> TargetSelection;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UXVPerceptionProfile> AppliedPerceptionProfile;
 #pragma endregion 
 };
\ No newline at end of file
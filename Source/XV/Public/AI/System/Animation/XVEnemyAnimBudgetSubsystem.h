@@ -0,0 +1,66 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "XVEnemyAnimBudgetSubsystem.generated.h"
+
+class AXVEnemyBase;
+
+// 애니메이션 갱신 등급 (Full 은 매 프레임, 나머지는 메쉬 틱 간격으로 프레임 스킵)
+enum class EXVAnimBudgetTier : uint8
+{
+	Full,
+	Half,
+	Quarter,
+	Minimal,
+};
+
+struct FXVAnimBudgetEntry
+{
+	TWeakObjectPtr<AXVEnemyBase> Enemy;
+	float Significance = 0.f;
+	EXVAnimBudgetTier Tier = EXVAnimBudgetTier::Full;
+	bool bCombat = false;
+	// 메쉬에 마지막으로 적용한 값 (바뀔 때만 다시 적용), true 면 URO 끄고 화면 밖에서도 포즈 갱신
+	bool bAlwaysTickPose = false;
+	// 처음 한 번은 무조건 적용
+	bool bApplied = false;
+};
+
+/**
+ * 적 애니메이션 예산 (군중용)
+ * - 메쉬는 URO(화면 크기 기반 프레임 스킵 + 보간) 사용, 여기서는 중요도 기반으로 메쉬 틱 간격을 추가 조절
+ * - 중요도 = 가장 가까운 로컬 카메라까지 거리 (최근 렌더링되지 않았으면 가중), 상위 N 명은 항상 매 프레임
+ * - 전투 중(플레이어 근처 / 몽타주 재생 / 근접 판정 구간)인 적은 항상 Full + 본 갱신
+ *   → 근접/원거리 판정 노티파이와 무기 소켓 위치가 실제 타이밍대로 유지됨
+ * - 틱 간격으로 건너뛴 프레임의 시간은 다음 틱에 합쳐서 진행되므로, 그 사이 노티파이도 빠짐없이 발생
+ */
+UCLASS()
+class XV_API UXVEnemyAnimBudgetSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	void RegisterEnemy(AXVEnemyBase* Enemy);
+	void UnregisterEnemy(AXVEnemyBase* Enemy);
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	FORCEINLINE int32 GetNumEnemies() const { return Entries.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	void UpdateSignificance();
+	void AssignTiers();
+	static void ApplyTier(FXVAnimBudgetEntry& Entry, EXVAnimBudgetTier NewTier, bool bAlwaysTickPose);
+	static bool IsInCombat(const AXVEnemyBase& Enemy, const FVector& Location, const class UXVTargetSelectionSubsystem* TargetSelection, float CombatDistance);
+
+	TArray<FXVAnimBudgetEntry> Entries;
+	TArray<FVector, TInlineAllocator<2>> ViewLocations;
+	// 중요도 정렬용 (재사용)
+	TArray<int32> SortedIndices;
+	float TimeUntilUpdate = 0.f;
+};
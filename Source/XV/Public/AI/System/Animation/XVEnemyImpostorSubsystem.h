@@ -0,0 +1,91 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "XVEnemyImpostorSubsystem.generated.h"
+
+class AXVEnemyBase;
+class UStaticMesh;
+class UInstancedStaticMeshComponent;
+
+// 임포스터 메쉬 하나당 인스턴스 묶음 (인스턴스 인덱스 == InstanceOwners 인덱스)
+USTRUCT()
+struct FXVImpostorBatch
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<UInstancedStaticMeshComponent> Component;
+
+	TArray<TWeakObjectPtr<AXVEnemyBase>> InstanceOwners;
+
+	// 매 프레임 재사용하는 트랜스폼 버퍼
+	TArray<FTransform> Transforms;
+};
+
+struct FXVImpostorAgent
+{
+	TWeakObjectPtr<AXVEnemyBase> Enemy;
+	TWeakObjectPtr<UStaticMesh> Mesh;
+	// 임포스터로 그리는 중이면 배치 안의 인스턴스 인덱스
+	int32 InstanceIndex = INDEX_NONE;
+	// 개체마다 애니메이션 위상을 다르게 (0~1)
+	float PhaseOffset = 0.f;
+	// 마지막으로 기록한 커스텀 데이터 (바뀔 때만 다시 기록)
+	bool bMoving = false;
+	float PlayRate = 0.f;
+
+	FORCEINLINE bool IsImpostor() const { return InstanceIndex != INDEX_NONE; }
+};
+
+/**
+ * 원거리 적 임포스터 렌더링
+ * - UAIConfigComponent::bUseImpostor 가 켜진 적만 대상, 카메라에서 ImpostorDistance 보다 멀면
+ *   스켈레탈 메쉬/무기를 숨기고 VAT 를 구운 스태틱 메쉬 인스턴스(ISM)로 그림 (메쉬당 드로우 1번)
+ * - 가까워지면(히스테리시스 적용) 인스턴스를 제거하고 스켈레탈 메쉬로 복귀
+ * - AI/이동/몽타주는 그대로 돌아감 (숨긴 메쉬는 UXVEnemyAnimBudgetSubsystem 이 저빈도로 갱신)
+ * - 인스턴스 커스텀 데이터 : [0] 시작 프레임 [1] 프레임 수 [2] 위상 오프셋(0~1) [3] 재생 배율
+ */
+UCLASS()
+class XV_API UXVEnemyImpostorSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	void RegisterEnemy(AXVEnemyBase* Enemy);
+	void UnregisterEnemy(AXVEnemyBase* Enemy);
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	int32 GetNumImpostors() const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+private:
+	// 거리 기준 전환 + 애니메이션 상태 갱신 (주기적으로)
+	void UpdateRepresentations();
+	// 임포스터 인스턴스 위치를 스켈레탈 메쉬 위치에 맞춤 (매 프레임)
+	void UpdateInstanceTransforms();
+
+	void EnterImpostor(FXVImpostorAgent& Agent);
+	void ExitImpostor(FXVImpostorAgent& Agent);
+	void WriteCustomData(FXVImpostorAgent& Agent, bool bForce);
+
+	FXVImpostorBatch* FindOrCreateBatch(UStaticMesh* Mesh);
+	static void SetSkeletalVisible(AXVEnemyBase& Enemy, bool bVisible);
+
+	TArray<FXVImpostorAgent> Agents;
+
+	UPROPERTY()
+	TMap<TObjectPtr<UStaticMesh>, FXVImpostorBatch> Batches;
+
+	// ISM 컴포넌트를 붙여 둘 액터 (처음 필요할 때 생성)
+	UPROPERTY()
+	TObjectPtr<AActor> ImpostorActor;
+
+	TArray<FVector, TInlineAllocator<2>> ViewLocations;
+	float TimeUntilUpdate = 0.f;
+};
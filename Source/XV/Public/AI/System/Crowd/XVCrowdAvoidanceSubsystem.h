@@ -0,0 +1,60 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "XVCrowdAvoidanceSubsystem.generated.h"
+
+class AXVEnemyBase;
+class UXVEnemySpatialGridSubsystem;
+
+// 회피 계산용 에이전트 스냅샷 (게임 스레드에서 복사 → 병렬 계산에서는 이 값만 읽음)
+struct FXVCrowdAgentSnapshot
+{
+	FVector Location = FVector::ZeroVector;
+	FVector Velocity = FVector::ZeroVector;
+	float CollisionRadius = 0.f;
+	float NeighborRadius = 0.f;
+	float Weight = 0.f;
+	float TimeHorizon = 0.f;
+	float MaxSpeed = 0.f;
+	int32 MaxNeighbors = 0;
+	int32 GridHandle = INDEX_NONE;
+};
+
+/**
+ * 적 군중 회피 (RVO 방식 간략화)
+ * - UAIConfigComponent::bUseCrowdAvoidance 가 켜진 적만 대상
+ * - 공간 격자로 이웃을 찾고, 이웃 계산은 ParallelFor 로 분산
+ * - 결과 속도는 UXVEnemyMovementComponent 가 이동 요청에 더함
+ */
+UCLASS()
+class XV_API UXVCrowdAvoidanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	void RegisterAgent(AXVEnemyBase* Enemy);
+	void UnregisterAgent(AXVEnemyBase* Enemy);
+
+	FORCEINLINE int32 GetNumAgents() const { return Agents.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	// 격자 핸들 기준 이웃 속도/반경 복사
+	void GatherNeighborSnapshot(const UXVEnemySpatialGridSubsystem& SpatialGrid);
+	// 에이전트 한 명의 회피 속도 (병렬 호출됨, UObject 접근 금지)
+	FVector ComputeAvoidance(const UXVEnemySpatialGridSubsystem& SpatialGrid, const FXVCrowdAgentSnapshot& Agent) const;
+
+	TArray<TWeakObjectPtr<AXVEnemyBase>> Agents;
+
+	// 프레임마다 재사용하는 버퍼
+	TArray<FXVCrowdAgentSnapshot> AgentSnapshots;
+	TArray<FVector> AvoidanceResults;
+	TArray<FVector> NeighborVelocities;
+	TArray<float> NeighborRadii;
+};
@@ -0,0 +1,50 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "XVNoiseAggregatorSubsystem.generated.h"
+
+// 발신자(Actor)별 소음 누적 상태
+struct FXVNoiseEmitterState
+{
+	FVector Location = FVector::ZeroVector;
+	FName Tag;
+	float PendingLoudness = 0.f;
+	float Window = 0.f;
+	double LastEmitTime = -UE_BIG_NUMBER;
+	bool bHasPending = false;
+};
+
+/**
+ * 플레이어 소음(총소리 등)을 발신자별로 모아서
+ * 윈도우당 최대 1번만 AI 청각 이벤트로 보내는 서브시스템
+ */
+UCLASS()
+class XV_API UXVNoiseAggregatorSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// 소음 보고 (윈도우가 지났으면 바로 전송, 아니면 누적 후 윈도우 끝에 한 번 전송)
+	// Window < 0 이면 XV.AI.NoiseWindow 값 사용
+	void ReportNoise(AActor* Instigator, const FVector& Location, float Loudness, FName Tag, float Window = -1.f);
+
+	// 적 BeginPlay 에서 확정된 청각 범위 등록 (후보 질의 반경 = 가장 넓은 청각 범위)
+	void RegisterHearingRange(float HearingRange);
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	void EmitNoise(AActor* Instigator, FXVNoiseEmitterState& State, double Now);
+	// 청각 범위 안에 적이 하나라도 있는지 (없으면 퍼셉션 이벤트 자체를 생략)
+	bool IsAnyListenerInRange(const FVector& Location, float Loudness) const;
+
+	TMap<TWeakObjectPtr<AActor>, FXVNoiseEmitterState> Emitters;
+
+	// 등록된 적 중 가장 넓은 청각 범위 (줄어들지 않음)
+	float MaxHearingRange = 0.f;
+};
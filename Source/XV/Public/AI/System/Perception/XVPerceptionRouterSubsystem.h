@@ -0,0 +1,43 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "XVPerceptionRouterSubsystem.generated.h"
+
+class APawn;
+class AController;
+
+/**
+ * AI 퍼셉션 콜백 공용 라우터
+ * - 플레이어 폰들은 빙의가 바뀔 때만 다시 찾음 (코옵 최대 4인)
+ * - 여러 AI가 같은 프레임에 플레이어를 발견해도 게임모드 호출은 프레임당 1번
+ */
+UCLASS()
+class XV_API UXVPerceptionRouterSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	// 감지된 액터가 플레이어 폰인지 (캐시 비교만 수행)
+	bool IsPlayerTarget(const AActor* Actor) const;
+	// 첫 번째 플레이어 폰 (타겟 선택은 UXVTargetSelectionSubsystem 사용)
+	APawn* GetPlayerPawn() const;
+
+	// 플레이어 발견 알림 (다음 프레임에 한 번만 게임모드로 전달)
+	void NotifyPlayerSpotted();
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	UFUNCTION()
+	void OnPawnControllerChanged(APawn* Pawn, AController* Controller);
+
+	void FlushPlayerSpotted();
+
+	TArray<TWeakObjectPtr<APawn>, TInlineAllocator<4>> CachedPlayerPawns;
+	bool bPlayerSpottedPending = false;
+};
@@ -0,0 +1,63 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AI/System/Spatial/XVSpatialHashGrid.h"
+#include "UObject/ObjectKey.h"
+#include "XVEnemySpatialGridSubsystem.generated.h"
+
+class AXVEnemyBase;
+
+/**
+ * 살아있는 적 위치를 균일 격자로 관리하는 서브시스템
+ * - 적은 BeginPlay/EndPlay 에서 등록/해제
+ * - 매 틱 위치를 갱신하되 셀이 바뀐 적만 셀 이동
+ * - 군중 분리, 범위 데미지, LOD 등 "X 근처의 적" 질의용 (액터 전체 순회 X)
+ */
+UCLASS()
+class XV_API UXVEnemySpatialGridSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	void RegisterEnemy(AXVEnemyBase* Enemy);
+	void UnregisterEnemy(AXVEnemyBase* Enemy);
+
+	// OutEnemies 는 Reset 후 채움 (호출자 버퍼 재사용), 찾은 개수 반환
+	int32 QueryRadius(const FVector& Center, float Radius, TArray<AXVEnemyBase*>& OutEnemies, const AXVEnemyBase* IgnoreEnemy = nullptr) const;
+	// HandleBuffer 는 격자 핸들 임시 버퍼 (호출자가 재사용)
+	int32 QueryBox(const FBox& Box, TArray<AXVEnemyBase*>& OutEnemies, TArray<int32>& HandleBuffer) const;
+
+	// 반경 안의 적마다 Func(AXVEnemyBase&, const FVector& 격자 위치) 호출
+	template<typename FuncType>
+	void ForEachEnemyInRadius(const FVector& Center, float Radius, FuncType&& Func) const
+	{
+		Grid.ForEachInRadius(Center, Radius, [this, &Func](int32 Handle, const FVector& Location)
+		{
+			if (AXVEnemyBase* Enemy = EnemyByHandle[Handle].Get())
+			{
+				Func(*Enemy, Location);
+			}
+		});
+	}
+
+	FORCEINLINE const FXVSpatialHashGrid& GetGrid() const { return Grid; }
+	FORCEINLINE int32 GetNumEnemies() const { return Grid.Num(); }
+	int32 GetHandle(const AXVEnemyBase* Enemy) const;
+	FORCEINLINE AXVEnemyBase* GetEnemy(int32 Handle) const { return EnemyByHandle.IsValidIndex(Handle) ? EnemyByHandle[Handle].Get() : nullptr; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	FXVSpatialHashGrid Grid;
+
+	// 격자 핸들 → 적 (핸들은 희소 배열 인덱스라 크기는 최대 핸들 기준)
+	TArray<TWeakObjectPtr<AXVEnemyBase>> EnemyByHandle;
+	TMap<TObjectKey<AXVEnemyBase>, int32> HandleByEnemy;
+};
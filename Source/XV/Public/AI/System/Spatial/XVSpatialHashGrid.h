@@ -0,0 +1,85 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * XY 평면 균일 격자 (UObject 아님, 핸들 기반)
+ * - 이동 시 셀이 바뀐 경우에만 셀 목록을 갱신
+ * - 쿼리 결과는 호출자가 넘긴 버퍼에 채움 (버퍼 재사용으로 할당 최소화)
+ */
+struct XV_API FXVSpatialHashGrid
+{
+public:
+	explicit FXVSpatialHashGrid(float InCellSize = 500.f);
+
+	// 셀 크기를 바꾸면 기존 항목은 모두 제거됨
+	void Reset(float InCellSize);
+
+	int32 Add(const FVector& Location);
+	void Remove(int32 Handle);
+	void Update(int32 Handle, const FVector& Location);
+
+	// OutHandles 는 Reset 후 채움, 찾은 개수 반환
+	int32 QueryRadius(const FVector& Center, float Radius, TArray<int32>& OutHandles) const;
+	int32 QueryBox(const FBox& Box, TArray<int32>& OutHandles) const;
+
+	// 반경 안 항목마다 Func(Handle, Location) 호출 (버퍼 없이 순회)
+	template<typename FuncType>
+	void ForEachInRadius(const FVector& Center, float Radius, FuncType&& Func) const;
+
+	FORCEINLINE bool IsValidHandle(int32 Handle) const { return Entries.IsValidIndex(Handle); }
+	FORCEINLINE const FVector& GetLocation(int32 Handle) const { return Entries[Handle].Location; }
+	FORCEINLINE int32 Num() const { return Entries.Num(); }
+	FORCEINLINE int32 GetMaxHandle() const { return Entries.GetMaxIndex(); }
+	FORCEINLINE float GetCellSize() const { return CellSize; }
+
+private:
+	struct FEntry
+	{
+		FVector Location = FVector::ZeroVector;
+		FIntPoint Cell = FIntPoint::ZeroValue;
+		int32 SlotInCell = INDEX_NONE;
+	};
+
+	FORCEINLINE FIntPoint ToCell(const FVector& Location) const
+	{
+		return FIntPoint(FMath::FloorToInt32(Location.X * InvCellSize), FMath::FloorToInt32(Location.Y * InvCellSize));
+	}
+
+	void AddToCell(int32 Handle, const FIntPoint& Cell);
+	void RemoveFromCell(int32 Handle);
+
+	float CellSize = 500.f;
+	float InvCellSize = 1.f / 500.f;
+
+	TSparseArray<FEntry> Entries;
+	TMap<FIntPoint, TArray<int32>> Cells;
+};
+
+template<typename FuncType>
+void FXVSpatialHashGrid::ForEachInRadius(const FVector& Center, float Radius, FuncType&& Func) const
+{
+	if (Entries.Num() == 0 || Radius < 0.f) return;
+
+	const FIntPoint MinCell = ToCell(Center - FVector(Radius));
+	const FIntPoint MaxCell = ToCell(Center + FVector(Radius));
+	const float RadiusSq = FMath::Square(Radius);
+
+	for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+	{
+		for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+		{
+			const TArray<int32>* CellHandles = Cells.Find(FIntPoint(CellX, CellY));
+			if (!CellHandles) continue;
+
+			for (const int32 Handle : *CellHandles)
+			{
+				const FVector& Location = Entries[Handle].Location;
+				if (FVector::DistSquared(Location, Center) <= RadiusSq)
+				{
+					Func(Handle, Location);
+				}
+			}
+		}
+	}
+}
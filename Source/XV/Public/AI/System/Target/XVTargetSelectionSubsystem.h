@@ -0,0 +1,60 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "XVTargetSelectionSubsystem.generated.h"
+
+class APawn;
+
+// 프레임 단위로 갱신되는 플레이어 폰 정보 (X 좌표 기준 정렬)
+struct FXVPlayerTargetEntry
+{
+	TWeakObjectPtr<APawn> Pawn;
+	FVector Location = FVector::ZeroVector;
+	float Threat = 0.f;
+};
+
+/**
+ * AI 공용 타겟 선택 서브시스템 (코옵 대응)
+ * - 매 프레임 모든 플레이어 폰 위치를 X 기준으로 정렬해 둠
+ * - 각 AI는 이진 탐색으로 가장 가까운/위협적인 플레이어를 O(log n)에 선택
+ * - BT 노드들은 직접 플레이어를 찾지 말고 여기서 받아 씀 (폰이 없으면 nullptr)
+ */
+UCLASS()
+class XV_API UXVTargetSelectionSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// 가장 가까운 플레이어 폰 (MaxDistance 밖이면 nullptr)
+	APawn* FindNearestTarget(const FVector& From, float MaxDistance = UE_BIG_NUMBER) const;
+
+	// 거리와 위협도를 함께 고려한 타겟 (점수 = 거리 - 위협도 * XV.AI.ThreatDistanceScale)
+	APawn* SelectTarget(const FVector& From) const;
+	APawn* SelectTargetFor(const APawn* Seeker) const;
+
+	// 플레이어 위협도 누적 (사격 등), 시간이 지나면 감소
+	void AddThreat(APawn* Player, float Amount);
+
+	FORCEINLINE int32 GetNumTargets() const { return Entries.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	// 플레이어 컨트롤러들의 폰으로 인덱스 재구성
+	void RebuildIndex();
+	// From.X 이상인 첫 엔트리 인덱스
+	int32 LowerBoundByX(float X) const;
+
+	TArray<FXVPlayerTargetEntry> Entries;
+	TMap<TWeakObjectPtr<APawn>, float> ThreatByPawn;
+
+	// 이번 프레임 최대 위협도 (탐색 범위 가지치기용)
+	float MaxThreat = 0.f;
+	uint64 LastBuildFrame = MAX_uint64;
+};
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "AI/Weapons/Base/AIWeaponBase.h"
+#include "XVSpread.h"
 #include "AIWeaponGunBase.generated.h"
 
 class UAudioComponent;
@@ -10,4 +11,11 @@ UCLASS()
 class XV_API AAIWeaponGunBase : public AAIWeaponBase
 {
 	GENERATED_BODY()
+
+public:
+	// 연사 반동 누적 (URangedCheckHit 에서 퍼짐 계산 시 사용)
+	FORCEINLINE FXVSpreadState& GetSpreadState() { return SpreadState; }
+
+private:
+	FXVSpreadState SpreadState;
 };
@@ -11,9 +11,45 @@ class XV_API AAIWeaponMeleeBase : public AAIWeaponBase
 	
 public:
 	AAIWeaponMeleeBase();
+
+	// === 근접 판정 구간 (UMeleeCheckHit 노티파이 스테이트에서 호출) ===
+	// 구간 시작: 이번 스윙에서 맞은 대상 초기화 후 현재 위치 판정
+	void BeginMeleeWindow();
+	// 구간 중: 이전 프레임 위치 -> 현재 위치로 박스 스윕
+	void TickMeleeWindow();
+	// 구간 끝: 마지막 스윕 후 아무도 못 맞췄으면 미스 사운드 (몽타주가 중단되어 끝난 경우 스윕/미스 사운드 없이 종료)
+	void EndMeleeWindow(bool bInterrupted = false);
+	// 구간 없이 한 번만 판정 (Begin + End)
 	void CheckMeleeHit();
 
+	FORCEINLINE bool IsMeleeWindowActive() const { return bMeleeWindowActive; }
+
 protected:
+	virtual void BeginPlay() override;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category= "AI")
 	TObjectPtr<UAudioComponent> NoHitSound;	
+
+	// 박스 크기에 더하는 여유 (판정을 넉넉하게)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category= "AI|Melee")
+	float MeleeExtentPadding = 0.f;
+
+	// 박스 크기가 0 일 때 대신 쓰는 구체 반경
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category= "AI|Melee")
+	float MeleeFallbackRadius = 80.f;
+
+private:
+	// 이전 위치 -> 현재 위치 스윕 후 맞은 플레이어마다 데미지 (스윙당 대상별 한 번)
+	void SweepMeleeVolume();
+	void ApplyMeleeHit(AActor* HitActor);
+
+	// 재사용하는 쿼리 파라미터/결과 배열 (BeginPlay 에서 한 번 구성)
+	FCollisionQueryParams MeleeQueryParams;
+	FCollisionObjectQueryParams MeleeObjectParams;
+	TArray<FHitResult> MeleeSweepHits;
+
+	// 이번 스윙에서 이미 맞은 대상 (스윙당 한 번만 데미지)
+	TArray<TWeakObjectPtr<AActor>, TInlineAllocator<4>> MeleeHitActors;
+	FTransform LastMeleeTransform;
+	bool bMeleeWindowActive = false;
 };
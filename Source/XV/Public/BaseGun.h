@@ -21,6 +21,9 @@ public:
 	virtual EWeaponType GetWeaponType();
 	virtual void FireBullet() override;
 
+	// 픽업 액터 그대로 캐릭터 무기 슬롯으로 옮겨질 때
+	virtual void OnEquipped(USceneComponent* Parent, FName SocketName = NAME_None);
+
 protected:
 	virtual void BeginPlay() override;
 
@@ -5,12 +5,24 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
 #include "WeaponTypes.h"
+#include "InputActionValue.h"
 #include "XVCharacter.generated.h"
 
 class AElevatorDoor;
 class USpringArmComponent;
 class UCameraComponent;
 class ABaseGun;
+class UXVCharacterMovementComponent;
+class UAnimMontage;
+enum class EXVRecordedInput : uint8;
+
+// 무기 타입별 장비 슬롯 배치 (주/보조 무기 오프셋이 붙을 소켓)
+struct FXVWeaponSlotLayout
+{
+	FName PrimarySocket;
+	FName SubSocket;
+	bool bPlayChangeAnim = false;
+};
 
 UCLASS()
 class XV_API AXVCharacter : public ACharacter
@@ -18,7 +30,7 @@ class XV_API AXVCharacter : public ACharacter
 	GENERATED_BODY()
 
 public:
-	AXVCharacter();
+	AXVCharacter(const FObjectInitializer& ObjectInitializer);
 
 	void SetHealth(float Value);
 	void AddHealth(float Value);
@@ -27,8 +39,16 @@ public:
 
 	void SetWeapon(EWeaponType Weapon);
 	EWeaponType GetWeapon() const;
+	// 대기 중인 슬롯 배치를 실제로 적용 (교체 애니메이션 노티파이에서 호출)
+	UFUNCTION(BlueprintCallable, Category="Weapon")
+	void ApplyPendingWeaponSlotLayout();
 	bool GetISRun() const;
 	bool GetIsSit() const;
+	UXVCharacterMovementComponent* GetXVCharacterMovement() const;
+	// 이동 컴포넌트의 상태를 블루프린트용 복사본에 반영
+	void SyncMovementStateMirrors(bool bInIsRun, bool bInIsSit);
+	// 녹화된 입력을 입력 핸들러로 전달 (UXVInputRecorderComponent 재생용)
+	void DispatchRecordedInput(EXVRecordedInput Id, const FInputActionValue& Value);
 	
 	// 현재 장착 무기 타입
 	UPROPERTY(BlueprintReadOnly, Category="Weapon")
@@ -41,6 +61,8 @@ public:
 	EWeaponType SubWeaponType;
 
 protected:
+	virtual void BeginPlay() override;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Camera")
 	USpringArmComponent* SpringArmComp;
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Camera")
@@ -51,6 +73,13 @@ protected:
 	float DefaultCameraLenght;
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera")
 	float ZoomCameraLenght; 
+
+	// 총소리를 AI에게 묶어서 보내는 간격 (초, 음수면 기본값 XV.AI.NoiseWindow 사용)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI")
+	float FireNoiseWindow = -1.f;
+	// 한 발당 소리 크기
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI")
+	float FireNoiseLoudness = 1.f;
 	
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement")
 	float NormalSpeed; 
@@ -58,9 +87,11 @@ protected:
 	float SprintSpeedMultiplier;
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Movement")
 	float SprintSpeed;
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement")
+	// 달리기/앉기 상태의 원본은 UXVCharacterMovementComponent (세이브 무브/압축 플래그로 예측)
+	// 아래는 블루프린트/애님 그래프에서 읽기 위한 복사본 (이동 컴포넌트가 갱신)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Movement")
 	bool bIsSit;
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement")
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Movement")
 	bool bIsRun;
 
 	// 무기
@@ -89,17 +120,27 @@ protected:
 	UPROPERTY()
 	ABaseGun* CurrentOverlappingWeapon;
 
+	// true면 무기 교체 시 소켓 이동을 교체 애니메이션의 노티파이 시점까지 미룸
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weapon")
+	bool bDeferWeaponSlotSwapToAnimNotify = false;
+
+	// 오프셋이 현재 붙어 있는 소켓 (바뀐 쪽만 다시 붙이기 위해 기록)
+	FName PrimaryOffsetSocket;
+	FName SubOffsetSocket;
+	EWeaponType PendingSlotWeaponType = EWeaponType::None;
+	bool bHasPendingSlotLayout = false;
+	// 교체 요청 번호 (이전 몽타주의 늦은 종료 이벤트 무시용)
+	uint32 PendingSlotSerial = 0;
+
+	// 주워서 주 무기 슬롯에 옮겨온 무기 (픽업 액터를 그대로 재사용)
+	UPROPERTY()
+	TObjectPtr<ABaseGun> EquippedPrimaryWeapon;
+
 	
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Overlap")
 	AElevatorDoor* Elevator;
 	
-	// 달리기 선형보간 관련 변수
-	FTimerHandle WalkSpeedInterpTimerHandle;
-	float CurrentWalkSpeed = 0.0f;
-	float TargetWalkSpeed = 0.0f;
-	float InterpSpeed = 1.0f;  //보간 시간		
-	
 	virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
 
 	UFUNCTION()
@@ -130,8 +171,11 @@ protected:
 	void ChangeToSubWeapon(const FInputActionValue& value);
 	UFUNCTION()
 	void OpenDoor(const FInputActionValue& value);
-	
-	void InterpWalkSpeed();
+
+	static const FXVWeaponSlotLayout& GetWeaponSlotLayout(EWeaponType Weapon);
+	void ApplyWeaponSlotLayout(const FXVWeaponSlotLayout& Layout);
+	// 들고 다니는 무기는 픽업 오버랩이 필요 없으므로 소켓 이동 시 오버랩 갱신을 막음
+	static void DisableCarriedWeaponOverlaps(AActor* WeaponActor);
 
 
 	UFUNCTION()
@@ -154,7 +198,15 @@ protected:
 	// 오버랩 끝 함수
 	void OnWeaponOverlapEnd(const ABaseGun* Weapon);
 
+	// 픽업 무기를 주 무기 슬롯으로 옮기고 이전 무기는 풀에 반납
+	void EquipPrimaryWeapon(ABaseGun* NewWeapon);
+	// 현재 발사에 사용할 주 무기
+	ABaseGun* GetPrimaryWeaponActor() const;
+
 private:
+	// 교체 몽타주가 노티파이 전에 끊기거나 끝났을 때 대기 중인 배치 적용
+	void OnWeaponChangeMontageFinished(UAnimMontage* Montage, bool bInterrupted, uint32 Serial);
+
 	// 캐릭터 스테이터스
 	float CurrentHealth;
 	float MaxHealth;
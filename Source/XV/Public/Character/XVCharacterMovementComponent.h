@@ -0,0 +1,100 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "XVCharacterMovementComponent.generated.h"
+
+// 서버 이동 응답에 보간 중인 걷기 속도를 덧붙임 (보정 응답일 때만 전송)
+struct FXVCharacterMoveResponseDataContainer : public FCharacterMoveResponseDataContainer
+{
+	typedef FCharacterMoveResponseDataContainer Super;
+
+	virtual void ServerFillResponseData(const UCharacterMovementComponent& CharacterMovement, const FClientAdjustment& PendingAdjustment) override;
+	virtual bool Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap) override;
+
+	float BlendedWalkSpeed = 0.f;
+};
+
+/**
+ * 플레이어 이동 컴포넌트
+ * - 달리기/앉기/조준 상태에 따른 걷기 속도 변화를 이동 틱 안에서 보간 (타이머 없음)
+ * - 보간은 이동(Move) 단위 DeltaTime 으로 진행되므로 프레임레이트와 무관
+ * - 네트워크
+ *   클라이언트 : 상태를 압축 플래그(FLAG_Custom_0~2)로 매 이동에 실어 보내고 바로 예측 이동
+ *   서버       : 같은 플래그/DeltaTime 으로 똑같이 보간, 위치가 어긋나면 보정 응답에 보간 속도를 함께 보냄
+ *   클라이언트 : 보정 시 서버 보간 속도에서 시작해 남은 세이브 무브를 재생
+ *   다른 클라이언트(시뮬레이티드 프록시) : 상태 1바이트만 복제 (애니메이션/외삽용)
+ */
+UCLASS()
+class XV_API UXVCharacterMovementComponent : public UCharacterMovementComponent
+{
+	GENERATED_BODY()
+
+	friend class FXVSavedMove_Character;
+
+public:
+	UXVCharacterMovementComponent();
+
+	// 입력 핸들러에서 호출 (실제 속도는 다음 이동부터 보간)
+	void SetWantsToSprint(bool bWants);
+	void SetWantsToSit(bool bWants);
+	void SetWantsToAim(bool bWants);
+
+	FORCEINLINE bool WantsToSprint() const { return bWantsToSprint; }
+	FORCEINLINE bool WantsToSit() const { return bWantsToSit; }
+	FORCEINLINE bool WantsToAim() const { return bWantsToAim; }
+	// 실제로 달리기 속도가 적용되는 상태인지 (앉기/조준 중이면 달리기 무시)
+	FORCEINLINE bool IsSprinting() const { return bWantsToSprint && !bWantsToSit && !bWantsToAim; }
+
+	// 현재 상태 기준 목표 걷기 속도 (MaxWalkSpeed * 배율)
+	float GetTargetWalkSpeed() const;
+	FORCEINLINE float GetBlendedWalkSpeed() const { return BlendedWalkSpeed; }
+
+	virtual float GetMaxSpeed() const override;
+	virtual FNetworkPredictionData_Client* GetPredictionData_Client() const override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Character Movement: Speed Blend", meta = (ClampMin = "1"))
+	float SprintSpeedMultiplier;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Character Movement: Speed Blend", meta = (ClampMin = "0", ClampMax = "1"))
+	float SitSpeedMultiplier;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Character Movement: Speed Blend", meta = (ClampMin = "0", ClampMax = "1"))
+	float AimSpeedMultiplier;
+
+	// FInterpTo 보간 속도 (클수록 빨리 목표 속도에 도달)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Character Movement: Speed Blend", meta = (ClampMin = "0"))
+	float SpeedBlendRate;
+
+protected:
+	virtual void UpdateFromCompressedFlags(uint8 Flags) override;
+	virtual void UpdateCharacterStateBeforeMovement(float DeltaSeconds) override;
+	virtual void OnMovementUpdated(float DeltaSeconds, const FVector& OldLocation, const FVector& OldVelocity) override;
+	virtual void ClientHandleMoveResponse(const FCharacterMoveResponseDataContainer& MoveResponse) override;
+	virtual bool ClientUpdatePositionAfterServerUpdate() override;
+
+private:
+	// 상태 3비트 <-> 1바이트 (시뮬레이티드 프록시 복제용)
+	uint8 PackMoveState() const;
+	void UnpackMoveState(uint8 State);
+
+	UFUNCTION()
+	void OnRep_MoveState();
+
+	// AXVCharacter 의 블루프린트용 복사본(bIsRun/bIsSit) 갱신
+	void SyncOwnerMirrors() const;
+
+	uint8 bWantsToSprint : 1;
+	uint8 bWantsToSit : 1;
+	uint8 bWantsToAim : 1;
+
+	// 이동 틱에서 보간 중인 걷기 속도 (음수 = 아직 초기화 전)
+	float BlendedWalkSpeed = -1.f;
+
+	// 서버 → 시뮬레이티드 프록시 (바뀐 프레임에만 전송)
+	UPROPERTY(ReplicatedUsing = OnRep_MoveState)
+	uint8 ReplicatedMoveState = 0;
+
+	FXVCharacterMoveResponseDataContainer XVMoveResponseDataContainer;
+};
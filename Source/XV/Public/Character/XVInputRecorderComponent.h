@@ -0,0 +1,107 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "InputActionValue.h"
+#include "XVInputRecorderComponent.generated.h"
+
+class UEnhancedInputComponent;
+class AXVCharacter;
+
+// 녹화 파일에 들어가는 입력 ID (파일 호환을 위해 순서 변경 금지, 뒤에만 추가)
+UENUM()
+enum class EXVRecordedInput : uint8
+{
+	Move,
+	StartJump,
+	StopJump,
+	Look,
+	StartSprint,
+	StopSprint,
+	Fire,
+	Sit,
+	StartZoom,
+	StopZoom,
+	PickUpWeapon,
+	ChangeToMainWeapon,
+	ChangeToSubWeapon,
+	OpenDoor,
+	Max UMETA(Hidden)
+};
+
+// 녹화된 입력 하나 (녹화 시작 기준 게임 시간)
+struct FXVRecordedInputEvent
+{
+	float Time = 0.f;
+	EXVRecordedInput Id = EXVRecordedInput::Move;
+	FInputActionValue Value;
+};
+
+/**
+ * 성능 측정용 입력 녹화/재생 (XVPlayerController 에 붙어 있음, 커맨드라인으로만 켜짐)
+ * 녹화) -XVRecordInput[=경로]            : Enhanced Input 액션 스트림을 바이너리로 저장 (기본 Saved/Profiling)
+ * 재생) -XVReplayInput=경로 [-XVReplayFPS=60] [-XVReplayCSV=경로] [-XVReplayNoExit]
+ *      : 고정 스텝으로 입력을 캐릭터에 그대로 전달, 프레임별 시간을 CSV 로 남기고 종료
+ *      : 시드는 녹화 파일에서 읽어 월드 초기화 때 적용 (-XVSeed 가 있으면 그 값 우선), 재생 중에는 게임 제한 시간 꺼짐
+ * 예) UnrealEditor-Cmd XV.uproject /Game/Maps/Main -game -nullrhi -unattended -XVReplayInput=Saved/Profiling/Session.xvinput
+ */
+UCLASS(ClassGroup=(Custom))
+class XV_API UXVInputRecorderComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UXVInputRecorderComponent();
+
+	// 캐릭터 입력 바인딩 시 같은 액션/트리거로 녹화용 바인딩 추가
+	void BindRecording(UEnhancedInputComponent* EnhancedInput);
+
+	FORCEINLINE bool IsRecording() const { return bRecording; }
+	FORCEINLINE bool IsReplaying() const { return bReplaying; }
+
+	// 커맨드라인에 재생 옵션이 있는지 (컨트롤러가 입력 매핑을 추가할지 판단할 때 사용)
+	static bool IsReplayRequested();
+	// 커맨드라인에 녹화 옵션이 있는지 (빙의/입력 바인딩이 BeginPlay 보다 먼저 일어나므로 바인딩 시점에 직접 확인)
+	static bool IsRecordRequested();
+	// 재생할 녹화 파일 헤더의 시드 (UXVRandomStreamSubsystem 이 웨이브 스폰 전에 사용)
+	static bool GetReplaySeed(int32& OutSeed);
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+private:
+	void RecordInput(EXVRecordedInput Id, const FInputActionValue& Value);
+	bool SaveRecording() const;
+	bool LoadRecording();
+	void StartReplay();
+	void RecordFrameTime();
+	void FinishReplay();
+
+	// 파일 포맷 (리틀 엔디안)
+	// 헤더 : Magic(uint32) Version(uint16) Seed(int32) MapName(FString) Duration(float) EventCount(int32)
+	// 이벤트 : Time(float) Id(uint8) ValueType(uint8) 값(Boolean 1바이트, AxisN 은 float N개)
+	static constexpr uint32 FileMagic = 0x52495658; // 'XVIR'
+	static constexpr uint16 FileVersion = 1;
+
+	TArray<FXVRecordedInputEvent> Events;
+	FString FilePath;
+	FString CSVPath;
+	FString RecordedMapName;
+	int32 RecordedSeed = 0;
+	float RecordedDuration = 0.f;
+	float ReplayFPS = 60.f;
+	double StartTime = 0.0;
+	int32 NextEventIndex = 0;
+	bool bRecording = false;
+	bool bReplaying = false;
+	bool bExitOnFinish = true;
+
+	// 재생 중 프레임별 측정값 (분포 비교용)
+	TArray<float> FrameMs;
+	TArray<float> GameThreadMs;
+	double LastFrameWallTime = 0.0;
+
+	TWeakObjectPtr<AXVCharacter> ReplayCharacter;
+};
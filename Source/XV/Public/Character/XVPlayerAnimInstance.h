@@ -4,8 +4,49 @@
 
 #include "CoreMinimal.h"
 #include "Animation/AnimInstance.h"
+#include "WeaponTypes.h"
 #include "XVPlayerAnimInstance.generated.h"
 
+class AXVCharacter;
+
+// 애님 그래프에서 읽는 값 (블루프린트 로직 없이 멤버 직접 접근 = Fast Path)
+USTRUCT(BlueprintType)
+struct FXVPlayerAnimState
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "PlayerAnim")
+	FVector Velocity = FVector::ZeroVector;
+
+	UPROPERTY(BlueprintReadOnly, Category = "PlayerAnim")
+	float GroundSpeed = 0.f;
+
+	// 액터 정면 기준 이동 방향 (-180 ~ 180)
+	UPROPERTY(BlueprintReadOnly, Category = "PlayerAnim")
+	float Direction = 0.f;
+
+	// 컨트롤러 회전과 액터 회전 차이 (에임 오프셋용)
+	UPROPERTY(BlueprintReadOnly, Category = "PlayerAnim")
+	float AimPitch = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "PlayerAnim")
+	float AimYaw = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "PlayerAnim")
+	bool bShouldMove = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "PlayerAnim")
+	bool bIsFalling = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "PlayerAnim")
+	bool bIsRun = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "PlayerAnim")
+	bool bIsSit = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "PlayerAnim")
+	EWeaponType WeaponType = EWeaponType::None;
+};
 
 UCLASS()
 class XV_API UXVPlayerAnimInstance : public UAnimInstance
@@ -13,11 +54,48 @@ class XV_API UXVPlayerAnimInstance : public UAnimInstance
 	GENERATED_BODY()	
 	
 public:
+	UXVPlayerAnimInstance();
+
 	UPROPERTY(EditDefaultsOnly, Category = "PlayerAnim")
 	class UAnimMontage* AttackAnimMontage;
 	UPROPERTY(EditDefaultsOnly, Category = "PlayerAnim")
 	class UAnimMontage* ChangeAnimMontage;
 	
 	void PlayAttackAnim();
-	void PlayGunChangeAnim();
+	// 몽타주가 실제로 재생되면 true
+	bool PlayGunChangeAnim();
+
+protected:
+	virtual void NativeInitializeAnimation() override;
+	// 게임 스레드: 캐릭터에서 원본 값만 복사
+	virtual void NativeUpdateAnimation(float DeltaSeconds) override;
+	// 워커 스레드: 복사한 값으로 State 계산 (캐릭터/컴포넌트 접근 금지)
+	virtual void NativeThreadSafeUpdateAnimation(float DeltaSeconds) override;
+
+	// 애님 그래프는 이 값만 읽음 (캐릭터 Getter 호출 X)
+	UPROPERTY(BlueprintReadOnly, Category = "PlayerAnim")
+	FXVPlayerAnimState State;
+
+	// 이동 중으로 판단할 최소 속도
+	UPROPERTY(EditDefaultsOnly, Category = "PlayerAnim")
+	float MoveSpeedThreshold = 3.f;
+
+private:
+	// 게임 스레드에서 모으는 원본 값
+	struct FGameThreadData
+	{
+		FVector Velocity = FVector::ZeroVector;
+		FVector Acceleration = FVector::ZeroVector;
+		FRotator ActorRotation = FRotator::ZeroRotator;
+		FRotator ControlRotation = FRotator::ZeroRotator;
+		EWeaponType WeaponType = EWeaponType::None;
+		bool bIsFalling = false;
+		bool bIsRun = false;
+		bool bIsSit = false;
+	};
+
+	FGameThreadData GameThreadData;
+
+	UPROPERTY()
+	TObjectPtr<AXVCharacter> Character;
 };
@@ -8,6 +8,7 @@
 
 class UInputMappingContext;
 class UInputAction;
+class UXVInputRecorderComponent;
 
 UCLASS()
 class XV_API AXVPlayerController : public APlayerController
@@ -43,4 +44,11 @@ public:
 	UInputAction* OpenDoorAction;
 	
 	virtual void BeginPlay() override;
+
+	FORCEINLINE UXVInputRecorderComponent* GetInputRecorder() const { return InputRecorder; }
+
+protected:
+	// 성능 측정용 입력 녹화/재생 (커맨드라인으로 켤 때만 동작)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Input")
+	TObjectPtr<UXVInputRecorderComponent> InputRecorder;
 };
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Animation/AnimNotifies/AnimNotify.h"
+#include "XVWeaponSwapNotify.generated.h"
+
+// 무기 교체 몽타주에서 손이 무기에 닿는 시점에 소켓 이동을 적용하는 노티파이
+UCLASS()
+class XV_API UXVWeaponSwapNotify : public UAnimNotify
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Notify(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference) override;
+};
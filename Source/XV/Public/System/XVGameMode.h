@@ -4,6 +4,8 @@
 #include "GameFramework/GameMode.h"
 #include "XVGameMode.generated.h"
 
+class AXVEnemyBase;
+
 UCLASS()
 class XV_API AXVGameMode : public AGameMode
 {
@@ -16,15 +18,25 @@ public:
 
 	void StartGame();
 	void SpawnEnemies() const;
-	void OnEnemyKilled();
+	void OnEnemyKilled(AXVEnemyBase* KilledEnemy);
 	void OnWaveTriggered();
 	void OnTimeLimitExceeded();
 	void EndGame(bool bIsClear);
 
+	// 성능 측정 실행(입력 재생) 중이면 제한 시간/게임 종료(일시정지, 레벨 이동)를 막음 (측정이 끝까지 돌도록)
+	static bool IsProfilingRun();
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "Level")
 	int32 MaxLevel;
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Level")
 	TArray<FName> LevelNames;
 	
 	FTimerHandle XVGameTimerHandle;
+
+private:
+	// 웨이브 스폰은 다음 프레임에 실행 (사망/파괴 처리 도중 연쇄 스폰 방지)
+	void SpawnPendingWave();
+	void RefreshArrivalPointState() const;
+
+	bool bWaveSpawnPending = false;
 };
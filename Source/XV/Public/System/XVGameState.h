@@ -4,6 +4,55 @@
 #include "GameFramework/GameState.h"
 #include "XVGameState.generated.h"
 
+class AXVEnemyBase;
+
+// 적 타입별 스폰/처치 집계
+USTRUCT(BlueprintType)
+struct FXVEnemyTypeCount
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 Spawned = 0;
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 Killed = 0;
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 Alive = 0;
+};
+
+// 레벨 진행 상태 (값이 바뀔 때만 알림/리플리케이션)
+USTRUCT(BlueprintType)
+struct FXVGameProgress
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 SpawnedEnemyCount = 0;
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 KilledEnemyCount = 0;
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	uint8 bIsWaveTriggered : 1;
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	uint8 bCanActiveArrivalPoint : 1;
+
+	FXVGameProgress()
+		: bIsWaveTriggered(false)
+		, bCanActiveArrivalPoint(true)
+	{
+	}
+
+	bool operator==(const FXVGameProgress& Other) const
+	{
+		return SpawnedEnemyCount == Other.SpawnedEnemyCount
+			&& KilledEnemyCount == Other.KilledEnemyCount
+			&& bIsWaveTriggered == Other.bIsWaveTriggered
+			&& bCanActiveArrivalPoint == Other.bCanActiveArrivalPoint;
+	}
+	bool operator!=(const FXVGameProgress& Other) const { return !(*this == Other); }
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnXVGameProgressChanged, const FXVGameProgress&, NewProgress, const FXVGameProgress&, OldProgress);
+
 UCLASS()
 class XV_API AXVGameState : public AGameState
 {
@@ -11,6 +60,8 @@ class XV_API AXVGameState : public AGameState
 
 public:
 	AXVGameState();
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 	
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Game Rules|Time")
 	float TimeLimit;
@@ -18,13 +69,50 @@ public:
 	int32 SpawnAllEnemyCount;
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Game Rules|Spawn")
 	int32 SpawnPatrolEnemyCount;
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Game Rules|Wave")
-	bool IsWaveTriggered;
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Game Rules|Wave")
-	bool CanActiveArrivalPoint;
 
-	int32 SpawnedEnemyCount;
-	int32 KilledEnemyCount;
+// === 진행 상태 =======================================================================================================//
+public:
+	FORCEINLINE const FXVGameProgress& GetProgress() const { return Progress; }
+	FORCEINLINE bool IsWaveTriggered() const { return Progress.bIsWaveTriggered; }
+	FORCEINLINE bool CanActiveArrivalPoint() const { return Progress.bCanActiveArrivalPoint; }
+	FORCEINLINE int32 GetSpawnedEnemyCount() const { return Progress.SpawnedEnemyCount; }
+	FORCEINLINE int32 GetKilledEnemyCount() const { return Progress.KilledEnemyCount; }
 
-	
+	void SetWaveTriggered(bool bTriggered);
+	void SetCanActiveArrivalPoint(bool bCanActive);
+
+	// 진행 상태가 바뀔 때 (서버: 즉시, 클라이언트: 리플리케이션 수신 시)
+	UPROPERTY(BlueprintAssignable, Category = "Game Rules|Progress")
+	FOnXVGameProgressChanged OnProgressChanged;
+
+protected:
+	UPROPERTY(ReplicatedUsing = OnRep_Progress, VisibleAnywhere, BlueprintReadOnly, Category = "Game Rules|Progress")
+	FXVGameProgress Progress;
+
+	UFUNCTION()
+	void OnRep_Progress(const FXVGameProgress& OldProgress);
+
+private:
+	// 값이 바뀌었으면 Dirty 표시 + 알림
+	void CommitProgress(const FXVGameProgress& OldProgress);
+
+// === 적 생존 관리 ====================================================================================================//
+public:
+	// 적이 월드에 등장했을 때 (BeginPlay)
+	void RegisterEnemy(AXVEnemyBase* Enemy);
+	// 적이 사망했을 때 (처치 수 증가)
+	void RecordEnemyKilled(AXVEnemyBase* Enemy);
+	// 사망 외의 이유로 제거될 때 (레벨 언로드 등, 처치 수에 포함 X)
+	void UnregisterEnemy(AXVEnemyBase* Enemy);
+
+	FORCEINLINE int32 GetAliveEnemyCount() const { return AliveEnemies.Num(); }
+	FORCEINLINE const TMap<TSubclassOf<AXVEnemyBase>, FXVEnemyTypeCount>& GetEnemyTypeCounts() const { return EnemyTypeCounts; }
+
+protected:
+	// 적 타입별 집계
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Game Rules|Spawn")
+	TMap<TSubclassOf<AXVEnemyBase>, FXVEnemyTypeCount> EnemyTypeCounts;
+
+private:
+	TSet<TWeakObjectPtr<AXVEnemyBase>> AliveEnemies;
 };
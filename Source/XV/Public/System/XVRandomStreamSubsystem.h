@@ -0,0 +1,50 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "XVRandomStreamSubsystem.generated.h"
+
+/**
+ * 월드별 시드 고정 난수 (재현 가능한 웨이브/성능 비교용)
+ * - 커맨드라인 -XVSeed=N 으로 시드 지정, -XVReplayInput 이면 녹화 파일의 시드, 둘 다 없으면 임의 시드를 로그로 남김 (그 값으로 재현 가능)
+ * - 용도(Domain)별로 스트림을 분리해서 한 시스템의 호출 횟수가 다른 시스템 결과를 바꾸지 않게 함
+ */
+UCLASS()
+class XV_API UXVRandomStreamSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	// 용도별 스트림 (처음 요청 시 기본 시드 + 용도 이름 해시로 생성)
+	FRandomStream& GetStream(FName Domain);
+
+	// 월드가 없거나 서브시스템이 없을 때도 쓸 수 있는 헬퍼 (없으면 전역 난수 사용)
+	static float FRand(const UObject* WorldContext, FName Domain);
+	static float FRandRange(const UObject* WorldContext, FName Domain, float Min, float Max);
+
+	// 스트림을 직접 넘겨야 할 때 (서브시스템이 없으면 한 번만 시드한 공용 대체 스트림)
+	static FRandomStream& GetStream(const UObject* WorldContext, FName Domain);
+
+	// 반경 안 임의 지점을 네비 메시에 투영 (엔진 랜덤 포인트 함수는 전역 난수를 써서 재현 불가)
+	static bool GetRandomNavPointInRadius(const UObject* WorldContext, FName Domain, const FVector& Origin, float Radius, FVector& OutPoint, int32 MaxAttempts = 4);
+
+	FORCEINLINE int32 GetSeed() const { return Seed; }
+
+	// 같은 월드에서 시드를 바꿔 다시 시작 (모든 스트림 초기화)
+	void Reseed(int32 NewSeed);
+
+	static const FName SpawnDomain;
+	static const FName CombatDomain;
+	static const FName NavigationDomain;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	static UXVRandomStreamSubsystem* Get(const UObject* WorldContext);
+
+	int32 Seed = 0;
+	TMap<FName, FRandomStream> Streams;
+};
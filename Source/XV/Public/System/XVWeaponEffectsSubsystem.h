@@ -0,0 +1,154 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "XVWeaponEffectsSubsystem.generated.h"
+
+class UNiagaraSystem;
+class UNiagaraComponent;
+class UNiagaraDataChannelAsset;
+class USoundBase;
+class USceneComponent;
+
+// 이펙트별 풀/동시 재생/컬링 설정 (무기에서 RegisterEffect 로 등록)
+USTRUCT(BlueprintType)
+struct FXVEffectSettings
+{
+	GENERATED_BODY()
+
+	// 등록 시 미리 만들어 둘 컴포넌트 수
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0"))
+	int32 PrewarmCount = 4;
+
+	// 동시에 재생 가능한 최대 개수
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "1"))
+	int32 MaxConcurrent = 8;
+
+	// 최대 개수에 도달했을 때 가장 오래된 것을 재사용 (false 면 새 요청을 버림)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bStealOldest = true;
+
+	// 모든 로컬 카메라에서 이 거리보다 멀면 생략 (0 이면 거리 컬링 X)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0.0"))
+	float CullDistance = 6000.f;
+
+	// 카메라 시야 밖이면 생략
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bCullOutsideView = true;
+};
+
+// 이펙트 하나의 컴포넌트 풀
+USTRUCT()
+struct FXVEffectPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<UNiagaraComponent>> FreeComponents;
+
+	// 재생 시작 순서 (0번이 가장 오래된 것)
+	UPROPERTY()
+	TArray<TObjectPtr<UNiagaraComponent>> ActiveComponents;
+
+	FXVEffectSettings Settings;
+};
+
+// 프레임 끝에 한 번에 처리할 이펙트 요청
+struct FXVQueuedNiagaraEffect
+{
+	// 에셋은 요청한 무기가 참조하고 있으므로 한 프레임 동안은 유지됨
+	UNiagaraSystem* System = nullptr;
+	TWeakObjectPtr<USceneComponent> AttachTo;
+	FName SocketName;
+	FTransform Transform;
+};
+
+// 피격 이펙트 요청 (데이터 채널이 있으면 채널별로 한 번에 기록)
+struct FXVQueuedImpact
+{
+	UNiagaraDataChannelAsset* DataChannel = nullptr;
+	UNiagaraSystem* FallbackSystem = nullptr;
+	FVector Location = FVector::ZeroVector;
+	FVector Normal = FVector::UpVector;
+};
+
+struct FXVQueuedSound
+{
+	USoundBase* Sound = nullptr;
+	FVector Location = FVector::ZeroVector;
+};
+
+struct FXVQueuedDebugShot
+{
+	FVector Start = FVector::ZeroVector;
+	FVector End = FVector::ZeroVector;
+	TWeakObjectPtr<AActor> HitActor;
+	float Duration = 0.f;
+	bool bHit = false;
+};
+
+/**
+ * 무기 발사 연출(머즐 플래시/피격/사운드/디버그 라인)을 모아서 프레임 끝에 처리하는 매니저
+ * - 판정(트레이스)은 발사 시점에 바로, 연출은 여기서 지연 처리
+ * - 나이아가라는 이펙트별 풀에서 재사용 (미리 생성 + 동시 재생 수 제한, 초과 시 가장 오래된 것 재사용)
+ * - 로컬 카메라 기준 거리/시야 밖 이펙트는 스폰하지 않음
+ * - 피격 이펙트는 나이아가라 데이터 채널에 프레임당 한 번에 기록 (채널 시스템 하나가 전부 그림)
+ * - 같은 프레임에 같은 사운드가 가까운 위치에서 여러 번 요청되면 한 번만 재생 (산탄)
+ */
+UCLASS()
+class XV_API UXVWeaponEffectsSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// 풀 설정 등록 + 미리 생성 (등록하지 않은 이펙트는 기본 설정으로 처음 요청 시 풀 생성)
+	void RegisterEffect(UNiagaraSystem* System, const FXVEffectSettings& Settings);
+
+	// AttachTo 가 있으면 소켓에 붙여서, 없거나 사라졌으면 Transform 위치에 스폰
+	void QueueNiagara(UNiagaraSystem* System, USceneComponent* AttachTo, FName SocketName, const FTransform& Transform);
+	// DataChannel 이 있으면 채널에 기록 (Position/Normal), 없으면 FallbackSystem 을 풀에서 스폰
+	void QueueImpact(UNiagaraDataChannelAsset* DataChannel, UNiagaraSystem* FallbackSystem, const FVector& Location, const FVector& Normal);
+	void QueueSound(USoundBase* Sound, const FVector& Location);
+	// XV.Weapon.DebugDraw 가 꺼져 있으면 무시
+	void QueueDebugShot(const FVector& Start, const FVector& End, bool bHit, AActor* HitActor, float Duration);
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual void Deinitialize() override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FXVEffectView
+	{
+		FVector Location;
+		FVector Forward;
+		float CosHalfFOV;
+	};
+
+	FXVEffectPool& FindOrAddPool(UNiagaraSystem* System);
+	UNiagaraComponent* CreatePooledComponent(UNiagaraSystem* System);
+	// 풀에서 꺼내기 (동시 재생 수 초과 시 가장 오래된 것 재사용, 불가하면 nullptr)
+	UNiagaraComponent* AcquireComponent(UNiagaraSystem* System);
+
+	UFUNCTION()
+	void OnPooledSystemFinished(UNiagaraComponent* Component);
+
+	void GatherViews();
+	bool IsCulled(const FVector& Location, const FXVEffectSettings& Settings) const;
+
+	void FlushNiagara();
+	void FlushImpacts();
+	void FlushSounds();
+	void FlushDebugShots();
+
+	UPROPERTY()
+	TMap<TObjectPtr<UNiagaraSystem>, FXVEffectPool> Pools;
+
+	TArray<FXVEffectView, TInlineAllocator<2>> Views;
+	TArray<FXVQueuedNiagaraEffect> PendingNiagara;
+	TArray<FXVQueuedImpact> PendingImpacts;
+	TArray<FXVQueuedSound> PendingSounds;
+	TArray<FXVQueuedDebugShot> PendingDebugShots;
+};
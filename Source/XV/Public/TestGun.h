@@ -2,7 +2,8 @@
 
 #include "CoreMinimal.h"
 #include "BaseGun.h"
-#include "NiagaraFunctionLibrary.h"
+#include "XVHitScan.h"
+#include "System/XVWeaponEffectsSubsystem.h"
 #include "TestGun.generated.h"
 
 UCLASS()
@@ -30,6 +31,20 @@ protected:
     // 이펙트 관련 변수
     UPROPERTY(EditAnywhere, Category = "Effects")
     UNiagaraSystem* MuzzleFlashNiagara;
+
+    UPROPERTY(EditAnywhere, Category = "Effects")
+    FXVEffectSettings MuzzleFlashSettings;
+
+    // 피격 이펙트 (데이터 채널이 있으면 채널로 한 번에 그림, Position/Normal 변수 필요)
+    UPROPERTY(EditAnywhere, Category = "Effects")
+    UNiagaraDataChannelAsset* ImpactDataChannel;
+
+    // 데이터 채널이 없을 때 피격 지점마다 풀에서 스폰
+    UPROPERTY(EditAnywhere, Category = "Effects")
+    UNiagaraSystem* ImpactNiagara;
+
+    UPROPERTY(EditAnywhere, Category = "Effects")
+    FXVEffectSettings ImpactSettings;
     
     UPROPERTY(EditAnywhere, Category = "Effects")
     USoundBase* FireSound;
@@ -37,6 +52,13 @@ protected:
     UPROPERTY(EditAnywhere, Category = "Effects")
     FName MuzzleSocketName;
 
+    // 무기 행에 퍼짐 설정이 없을 때(bUseSpread == false) 산탄총(EWeaponType::ShotGun) 한 발당 탄 수와 퍼짐 반각
+    UPROPERTY(EditAnywhere, Category = "ShotGun", meta = (ClampMin = "1"))
+    int32 ShotGunPelletCount;
+
+    UPROPERTY(EditAnywhere, Category = "ShotGun", meta = (ClampMin = "0.0"))
+    float ShotGunSpreadAngle;
+
     // 디버그 설정
     UPROPERTY(EditAnywhere, Category = "Debug")
     float DebugDrawDuration;
@@ -46,8 +68,15 @@ protected:
 
 private:
     FTimerHandle AutoFireTimerHandle;
+    void StartAutoFire();
     void AutoFireTimerCallback();
     
     // 컨스트럭터에서 초기화할 변수들
     FRotator DefaultRotation;
+
+    // 총구 소켓 조회 캐시
+    FXVSocketCache MuzzleSocketCache;
+
+    // 연사 반동 누적 (WeaponStat.bUseSpread 일 때만)
+    FXVSpreadState SpreadState;
 };
\ No newline at end of file
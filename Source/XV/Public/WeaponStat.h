@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Engine/DataTable.h"
+#include "XVSpread.h"
 #include "WeaponStat.generated.h"
 
 USTRUCT(BlueprintType)
@@ -35,6 +36,14 @@ struct FWeaponStat : public FTableRowBase
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	USkeletalMesh* WeaponMesh;
 
+	// Spread 값을 직접 지정한 행인지 (false 면 총기 쪽 기본값 사용: 산탄총은 ShotGunPelletCount/ShotGunSpreadAngle, 그 외는 퍼짐 없음)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bUseSpread = false;
+
+	// 탄 퍼짐/반동/거리 감쇠 (산탄총은 PelletCount 로 여러 발)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (EditCondition = "bUseSpread"))
+	FXVSpreadParams Spread;
+
 	// 총기 블루프린트 클래스 (스폰용)
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	TSubclassOf<class ABaseGun> WeaponClass;
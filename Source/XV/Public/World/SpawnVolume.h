@@ -28,4 +28,6 @@ public:
 	FVector GetEnemySpawnPoint() const;
 	AActor* SpawnEnemy(TSubclassOf<AActor> EnemyClass);
 	AActor* SpawnRandomEnemy();
+	// 박스 안 임의 위치에 스폰 (같은 볼륨에서 여러 마리를 연속 스폰할 때)
+	AActor* SpawnEnemyInBox(TSubclassOf<AActor> EnemyClass);
 };
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+
+class USkeletalMeshComponent;
+class USkeletalMesh;
+class USkeletalMeshSocket;
+
+// 소켓 조회 결과 캐시 (메쉬가 바뀌면 다시 조회)
+struct XV_API FXVSocketCache
+{
+	// 소켓 월드 트랜스폼을 한 번에 계산. 소켓이 없으면 컴포넌트 트랜스폼을 넣고 false 반환
+	bool GetSocketTransform(const USkeletalMeshComponent* Mesh, FName SocketName, FTransform& OutTransform);
+	void Invalidate();
+
+private:
+	TWeakObjectPtr<const USkeletalMesh> CachedMesh;
+	FName CachedSocketName;
+	// 메쉬 에셋이 소유 (CachedMesh 가 같을 때만 사용)
+	const USkeletalMeshSocket* Socket = nullptr;
+	int32 BoneIndex = INDEX_NONE;
+	bool bResolved = false;
+};
+
+/**
+ * 히트스캔 발사 (탄 방향은 FXVSpreadModel 에서 계산)
+ * 산탄총처럼 여러 발을 쏘는 경우도 한 번의 호출로 같은 쿼리 파라미터를 공유해서 처리
+ */
+struct XV_API FXVHitScan
+{
+	// 방향마다 트레이스 1회, OutHits 는 방향과 같은 순서 (맞지 않은 탄은 bBlockingHit = false, TraceEnd 만 채움)
+	// 반환값 = 맞은 탄 수
+	static int32 TraceBatch(const UWorld* World, const FVector& Origin, TConstArrayView<FVector> Directions, float Range,
+		ECollisionChannel Channel, const FCollisionQueryParams& QueryParams, TArray<FHitResult, TInlineAllocator<16>>& OutHits);
+};
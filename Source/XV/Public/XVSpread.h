@@ -0,0 +1,66 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "XVSpread.generated.h"
+
+// 탄 퍼짐/반동/거리 감쇠 설정 (플레이어 무기는 FWeaponStat, AI 는 URangedCheckHit 에서 사용)
+USTRUCT(BlueprintType)
+struct FXVSpreadParams
+{
+	GENERATED_BODY()
+
+	// 한 번 발사 시 탄 수 (산탄총은 여러 발)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "1", ClampMax = "32"))
+	int32 PelletCount = 1;
+
+	// 반동이 없을 때 원뿔 반각 (도)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0.0"))
+	float BaseSpreadDegrees = 1.f;
+
+	// 반동 포함 최대 원뿔 반각 (도)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0.0"))
+	float MaxSpreadDegrees = 8.f;
+
+	// 한 발마다 더해지는 반동 (도)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0.0"))
+	float RecoilPerShotDegrees = 0.5f;
+
+	// 초당 반동 회복량 (도)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0.0"))
+	float RecoilRecoveryPerSecond = 4.f;
+
+	// 이 거리부터 데미지 감소 시작
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0.0"))
+	float FalloffStartDistance = 1500.f;
+
+	// 이 거리에서 MinDamageScale 까지 감소
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0.0"))
+	float FalloffEndDistance = 4000.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float MinDamageScale = 0.3f;
+};
+
+// 무기별 반동 누적 상태
+struct FXVSpreadState
+{
+	float RecoilDegrees = 0.f;
+	double LastShotTime = -UE_BIG_NUMBER;
+};
+
+/**
+ * 플레이어/AI 공용 탄 퍼짐 모델
+ * - 난수는 호출자가 넘긴 스트림에서 탄당 2개씩 고정 순서로 뽑음 (같은 시드면 같은 결과)
+ * - 여러 발은 난수 -> 각도 -> 방향 순서로 배열 단위 반복 처리 (탄마다 분기 없음)
+ */
+struct XV_API FXVSpreadModel
+{
+	// 반동 회복 적용 후 이번 발의 원뿔 반각을 반환하고 반동 누적
+	static float ConsumeShot(const FXVSpreadParams& Params, FXVSpreadState& State, double Now);
+
+	// Forward 기준 반각 HalfAngleDegrees 원뿔 안에 균일 분포로 NumPellets 개 방향 생성
+	static void EvaluatePellets(const FVector& Forward, float HalfAngleDegrees, int32 NumPellets, FRandomStream& Stream, TArray<FVector, TInlineAllocator<16>>& OutDirections);
+
+	// 거리별 데미지 배율 (FalloffStart 까지 1, FalloffEnd 에서 MinDamageScale)
+	static float GetDamageScale(const FXVSpreadParams& Params, float Distance);
+};
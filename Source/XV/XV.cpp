@@ -2,5 +2,30 @@
 
 #include "XV.h"
 #include "Modules/ModuleManager.h"
+#include "CoreGlobals.h"
 
 IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, XV, "XV" );
+
+DEFINE_STAT(STAT_XV_ControllerTick);
+DEFINE_STAT(STAT_XV_Perception);
+DEFINE_STAT(STAT_XV_BTTask);
+DEFINE_STAT(STAT_XV_BTService);
+DEFINE_STAT(STAT_XV_AnimNotify);
+DEFINE_STAT(STAT_XV_HitCheck);
+DEFINE_STAT(STAT_XV_WeaponFire);
+DEFINE_STAT(STAT_XV_Spawn);
+DEFINE_STAT(STAT_XV_AISubsystems);
+
+DEFINE_STAT(STAT_XV_ActiveEnemies);
+DEFINE_STAT(STAT_XV_NavRequests);
+DEFINE_STAT(STAT_XV_Traces);
+
+bool FXVStressCounters::bEnabled = false;
+uint64 FXVStressCounters::AITickCycles = 0;
+int32 FXVStressCounters::NavQueries = 0;
+int32 FXVStressCounters::AITickScopeDepth = 0;
+
+float XVProfiling::GetGameThreadMs()
+{
+	return static_cast<float>(FPlatformTime::ToMilliseconds(GGameThreadTime));
+}
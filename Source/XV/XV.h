@@ -3,4 +3,80 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
+// === 프로파일링 (stat XV / Unreal Insights) ===========================================================================//
+DECLARE_STATS_GROUP(TEXT("XV"), STATGROUP_XV, STATCAT_Advanced);
+
+// 사이클 (분류별 합계, Insights 에는 함수 이름으로 표시)
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Controller Tick"), STAT_XV_ControllerTick, STATGROUP_XV, XV_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Perception"), STAT_XV_Perception, STATGROUP_XV, XV_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("BT Task"), STAT_XV_BTTask, STATGROUP_XV, XV_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("BT Service"), STAT_XV_BTService, STATGROUP_XV, XV_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Anim Notify"), STAT_XV_AnimNotify, STATGROUP_XV, XV_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Hit Check"), STAT_XV_HitCheck, STATGROUP_XV, XV_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Weapon Fire"), STAT_XV_WeaponFire, STATGROUP_XV, XV_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Spawn"), STAT_XV_Spawn, STATGROUP_XV, XV_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AI Subsystems"), STAT_XV_AISubsystems, STATGROUP_XV, XV_API);
+
+// 카운터 (Counter 는 매 프레임 0으로 초기화)
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Active Enemies"), STAT_XV_ActiveEnemies, STATGROUP_XV, XV_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Nav Requests / Frame"), STAT_XV_NavRequests, STATGROUP_XV, XV_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Traces / Frame"), STAT_XV_Traces, STATGROUP_XV, XV_API);
+
+// stat XV 사이클 + Insights CPU 스코프를 함께 기록
+// 같은 스탯이 중첩되지 않도록 바깥 진입점에서만 사용 (안쪽 함수는 TRACE_CPUPROFILER_EVENT_SCOPE)
+#define XV_SCOPE_CYCLE_COUNTER(Stat) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
+// stat XV 와 스트레스 테스트 CSV 가 같은 지점에서 세도록 함께 증가
+#define XV_COUNT_NAV_REQUEST() \
+	do { INC_DWORD_STAT(STAT_XV_NavRequests); ++FXVStressCounters::NavQueries; } while (0)
+#define XV_COUNT_TRACE() INC_DWORD_STAT(STAT_XV_Traces)
+
+// === 성능 측정 도구 공용 (스트레스 테스트 / 입력 재생) =================================================================//
+namespace XVProfiling
+{
+	// 직전 프레임 게임 스레드가 실제로 일한 시간 (ms, 프레임 제한 대기 제외)
+	XV_API float GetGameThreadMs();
+}
+
+// 스트레스 테스트가 구간마다 읽고 초기화하는 카운터 (게임 스레드 전용)
+// AITickCycles 는 bEnabled 일 때만 누적, NavQueries 는 XV_COUNT_NAV_REQUEST 에서 항상 증가
+struct XV_API FXVStressCounters
+{
+	static bool bEnabled;
+	static uint64 AITickCycles;
+	static int32 NavQueries;
+	// 열려 있는 FXVStressAITickScope 수 (바깥 스코프만 시간 누적)
+	static int32 AITickScopeDepth;
+
+	static void Reset()
+	{
+		AITickCycles = 0;
+		NavQueries = 0;
+	}
+};
+
+// AI 시간 누적용 스코프 (컨트롤러/AI 서브시스템 틱, BT 태스크/서비스, 퍼셉션 콜백)
+struct FXVStressAITickScope
+{
+	FXVStressAITickScope()
+		: StartCycles(FXVStressCounters::bEnabled && FXVStressCounters::AITickScopeDepth == 0 ? FPlatformTime::Cycles64() : 0)
+	{
+		++FXVStressCounters::AITickScopeDepth;
+	}
+	~FXVStressAITickScope()
+	{
+		--FXVStressCounters::AITickScopeDepth;
+		if (StartCycles != 0)
+		{
+			FXVStressCounters::AITickCycles += FPlatformTime::Cycles64() - StartCycles;
+		}
+	}
+
+private:
+	uint64 StartCycles;
+};